@@ -1536,6 +1536,13 @@ std::error_code DataAggregator::parseBranchEvents() {
   uint64_t NumSamplesNoLBR = 0;
   bool NeedsSkylakeFix = false;
 
+  // FIXME: samples are parsed and aggregated on a single thread. The
+  // aggregated counts in BranchLBRs and FallthroughLBRs are additive, so the
+  // perf script output could be split at line boundaries and each chunk
+  // aggregated into its own maps, then merged. That needs the parser cursor
+  // (ParsingBuf, Line, Col) to stop being shared DataReader state, and the
+  // Skylake workaround below to be decided before the first chunk is parsed
+  // rather than upon seeing the first 32-entry sample.
   while (hasData() && NumTotalSamples < opts::MaxSamples) {
     ++NumTotalSamples;
 
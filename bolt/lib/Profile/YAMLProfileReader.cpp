@@ -868,6 +868,11 @@ Error YAMLProfileReader::readProfile(BinaryContext &BC) {
   NormalizeByInsnCount = usesEvent("cycles") || usesEvent("instructions");
   NormalizeByCalls = usesEvent("branches");
   uint64_t NumUnused = 0;
+  // FIXME: profiles, including stale profile inference, are applied one
+  // function at a time. Each function only touches its own CFG, but
+  // parseFunctionProfile() and inferStaleProfile() also bump the plain
+  // counters in BC.Stats, so those would need to become per-function tallies
+  // summed afterwards before this loop could use ParallelUtilities.
   for (yaml::bolt::BinaryFunctionProfile &YamlBF : YamlBP.Functions) {
     if (BinaryFunction *BF = YamlProfileToFunction.lookup(YamlBF.Id))
       parseFunctionProfile(*BF, YamlBF);
@@ -766,6 +766,12 @@ void DWARFRewriter::updateDebugInfo() {
     ThreadPool.wait();
     for (std::unique_ptr<DIEBuilder> &DWODIEBuilderPtr : DWODIEBuildersByCU)
       DWODIEBuilderPtr->updateDebugNamesTable();
+    // FIXME: only split units are rewritten on the thread pool. Skeleton and
+    // regular CUs of a bucket are processed in order because they append to
+    // the shared RangeListsSectionWriter/LegacyRangesSectionWriter, whose
+    // current offset becomes the CU's ranges base attribute.
+    // Parallelizing this loop would need per-CU range writers that are
+    // concatenated afterwards, as is already done for DWO ranges.
     for (DWARFUnit *CU : DIEBlder.getProcessedCUs())
       processMainBinaryCU(*CU, DIEBlder);
     finalizeCompileUnits(DIEBlder, *Streamer, OffsetMap,
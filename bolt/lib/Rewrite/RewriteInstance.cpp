@@ -3399,6 +3399,13 @@ void RewriteInstance::processProfileData() {
 void RewriteInstance::disassembleFunctions() {
   NamedRegionTimer T("disassembleFunctions", "disassemble functions",
                      TimerGroupName, TimerGroupDesc, opts::TimeRewrite);
+  // FIXME: unlike buildFunctionsCFG(), disassembly runs sequentially.
+  // BinaryFunction::disassemble() creates labels in the shared MCContext,
+  // registers global symbols and jump tables in BinaryContext, and records
+  // interprocedural references, none of which is synchronized. Running it
+  // with runOnEachFunction() would first require making those BinaryContext
+  // entry points safe to call concurrently (or deferring them to a serial
+  // merge step) while keeping symbol names deterministic.
   for (auto &BFI : BC->getBinaryFunctions()) {
     BinaryFunction &Function = BFI.second;
 
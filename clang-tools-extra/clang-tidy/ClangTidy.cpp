@@ -594,6 +594,12 @@ runClangTidy(clang::tidy::ClangTidyContext &Context,
     ClangTidyASTConsumerFactory ConsumerFactory;
   };
 
+  // FIXME: ClangTool processes the input files one at a time. It reuses one
+  // FileManager, but it still parses the headers of every TU again. Running
+  // TUs on worker threads would need a ClangTidyContext, diagnostic consumer
+  // and check instances per thread, because all three keep per-file state. The
+  // resulting errors would also have to be merged in input order. Sharing
+  // preambles between TUs with a common include prefix is a separate step.
   ActionFactory Factory(Context, std::move(BaseFS));
   Tool.run(&Factory);
   return DiagConsumer.take();
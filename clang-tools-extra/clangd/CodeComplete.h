@@ -288,6 +288,13 @@ struct SpeculativeFuzzyFind {
 /// the speculative result is used by code completion (e.g. speculation failed),
 /// the speculative result is not consumed, and `SpecFuzzyFind` is only
 /// destroyed when the async request finishes.
+///
+/// FIXME: Sema completion is run from scratch on every request, even when
+/// only the typed filter text changed since the previous one. Unless the
+/// result is marked incomplete, clients are expected to re-filter locally. A
+/// server-side cache of the unfiltered Sema results would have to be keyed on
+/// the file version and the completion point (not the cursor) and dropped on
+/// any other edit, since a change anywhere in the file can change the results.
 CodeCompleteResult codeComplete(PathRef FileName, Position Pos,
                                 const PreambleData *Preamble,
                                 const ParseInputs &ParseInput,
@@ -153,6 +153,14 @@ struct PreambleBuildStats {
 /// If \p PreambleCallback is set, it will be run on top of the AST while
 /// building the preamble.
 /// If Stats is not non-null, build statistics will be exported there.
+///
+/// FIXME: Each file gets its own preamble, even when several open files have
+/// the same include prefix and flags. A preamble can't simply be shared by
+/// content hash, because it is built as a prefix of the main file: the PCH
+/// records the main file's name and the source locations of the preamble
+/// region, and the collected includes, macros and diagnostics refer to them.
+/// A shared preamble would need a neutral main file, plus a PreamblePatch-like
+/// step that maps those locations into each real file.
 std::shared_ptr<const PreambleData>
 buildPreamble(PathRef FileName, CompilerInvocation CI,
               const ParseInputs &Inputs, bool StoreInMemory,
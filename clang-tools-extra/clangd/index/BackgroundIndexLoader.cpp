@@ -121,6 +121,11 @@ loadIndexShards(llvm::ArrayRef<Path> MainFiles,
                 BackgroundIndexStorage::Factory &IndexStorageFactory,
                 const GlobalCompilationDatabase &CDB) {
   BackgroundIndexLoader Loader(IndexStorageFactory);
+  // FIXME: Shards are read and deserialized one after another on this thread.
+  // Most of the time goes to readIndexFile, and shards don't depend on each
+  // other, so that part could run on a pool. The include-graph walk that
+  // finds the shards and the LoadedShards map would still need to be
+  // serialized, and the result order kept stable.
   for (llvm::StringRef MainFile : MainFiles) {
     assert(llvm::sys::path::is_absolute(MainFile));
     Loader.load(MainFile);
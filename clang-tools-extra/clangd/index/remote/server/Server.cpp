@@ -442,6 +442,11 @@ void hotReload(clangd::SwapIndex &Index, llvm::StringRef IndexPath,
        "{0}, new index was modified at {1}. Attempting to reload.",
        LastStatus.getLastModificationTime(), Status->getLastModificationTime());
   LastStatus = *Status;
+  // FIXME: The new index is fully built in memory while the old one is still
+  // serving, so a reload needs twice the memory of one index. Avoiding that
+  // would need an index format that is served straight from a memory-mapped
+  // file, e.g. split into shards that are queried in parallel, rather than
+  // one deserialized into Dex.
   std::unique_ptr<clang::clangd::SymbolIndex> NewIndex =
       loadIndex(IndexPath, SymbolOrigin::Static, /*UseDex=*/true,
                 /*SupportContainedRefs=*/true);
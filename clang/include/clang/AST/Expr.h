@@ -1275,6 +1275,11 @@ class DeclRefExpr final
 
   /// Provides source/type location info for the declaration name
   /// embedded in D.
+  ///
+  /// FIXME: This is empty for plain identifiers, which is nearly every
+  /// DeclRefExpr, yet costs 8 bytes in each. It could become a trailing object
+  /// present only for operator, conversion and constructor names, with a bit
+  /// in DeclRefExprBits, at the cost of updating ASTStmtReader's CreateEmpty.
   DeclarationNameLoc DNLoc;
 
   size_t numTrailingObjects(OverloadToken<NestedNameSpecifierLoc>) const {
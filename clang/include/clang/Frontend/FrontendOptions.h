@@ -328,7 +328,10 @@ public:
   unsigned FixToTemporaries : 1;
 
   /// Skip over function bodies to speed up parsing in cases you do not need
-  /// them (e.g. with code completion).
+  /// them (e.g. with code completion, or tools that only need declarations).
+  /// Bodies of constexpr functions and of functions with a deduced return
+  /// type are still parsed, since later declarations may depend on them; see
+  /// Sema::canSkipFunctionBody.
   LLVM_PREFERRED_TYPE(bool)
   unsigned SkipFunctionBodies : 1;
 
@@ -284,6 +284,13 @@ class HeaderSearch {
 
   /// All of the preprocessor-specific data about files that are
   /// included, indexed by the FileEntry's UID.
+  ///
+  /// FIXME: This, including the controlling macro of each header, lives only
+  /// as long as one compilation. Sharing it across TUs in a long-lived
+  /// process would also need the FileManager (which owns the UIDs) to
+  /// outlive each compilation, and the controlling macro is an IdentifierInfo
+  /// owned by the per-TU IdentifierTable, so it would need to be stored by
+  /// name instead.
   mutable std::vector<HeaderFileInfo> FileInfo;
 
   /// Keeps track of each lookup performed by LookupFile.
@@ -46,6 +46,12 @@ class MacroArgs final
   /// PreExpArgTokens - Pre-expanded tokens for arguments that need them.  Empty
   /// if not yet computed.  This includes the EOF marker at the end of the
   /// stream.
+  ///
+  /// FIXME: This memoizes pre-expansion only within one invocation. Reusing it
+  /// across invocations with identical arguments is not possible as-is: every
+  /// expanded token carries a SourceLocation in a fresh macro-expansion
+  /// SLocEntry that diagnostics and -E depend on, so a cross-invocation cache
+  /// would have to remap locations rather than copy tokens.
   std::vector<std::vector<Token> > PreExpArgTokens;
 
   /// ArgCache - This is a linked list of MacroArgs objects that the
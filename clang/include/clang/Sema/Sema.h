@@ -14802,6 +14802,14 @@ private:
   /// here.
   llvm::DenseMap<const NamedDecl *, NormalizedConstraint *> NormalizationCache;
 
+  /// Caches the result of checking a constrained declaration's constraints
+  /// against a given template argument list, for the lifetime of this Sema.
+  ///
+  /// FIXME: Results are not written to PCMs, so every importer of a
+  /// concept-heavy module re-checks the same satisfactions. Serializing them
+  /// would need the cache key (the constrained decl and canonical arguments)
+  /// to be stable across TUs, and unsatisfied entries hold diagnostics that
+  /// refer to the TU that produced them.
   llvm::ContextualFoldingSet<ConstraintSatisfaction, const ASTContext &>
       SatisfactionCache;
 
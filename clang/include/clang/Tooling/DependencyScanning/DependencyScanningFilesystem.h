@@ -150,6 +150,12 @@ using CachedRealPath = llvm::ErrorOr<std::string>;
 ///
 /// It is sharded based on the hash of the key to reduce the lock contention for
 /// the worker threads.
+///
+/// The cache lives only as long as the owning DependencyScanningService.
+/// Persisting it across invocations would need more than serializing the
+/// entries: directive tokens point into the original file contents, and
+/// every entry would have to be revalidated against the file system (size and
+/// mtime at least) before reuse, which is the stat the cache exists to avoid.
 class DependencyScanningFilesystemSharedCache {
 public:
   struct CacheShard {
@@ -2070,6 +2070,10 @@ bool Interpret(InterpState &S) {
   if (!PC)
     return true;
 
+  // FIXME: Unlike the tree-walking evaluator, this loop does not count steps,
+  // so -fconstexpr-steps only limits a few builtins and array allocation
+  // sizes here. Enforcing it (e.g. on backward jumps and calls) is one of the
+  // gaps to close before this interpreter can be the default.
   for (;;) {
     auto Op = PC.read<Opcode>();
     CodePtr OpPC = PC;
@@ -1049,18 +1049,28 @@ private:
     const bool EnableCheckProfiling = Options.CheckProfiling.has_value();
     TimeBucketRegion Timer;
     auto &Matchers = this->Matchers->DeclOrStmt;
+    // Whether the node is ignored only depends on the traversal kind, and most
+    // matchers use the same one, so remember the last answer.
+    bool HaveLastTraversal = false;
+    std::optional<TraversalKind> LastTraversalKind;
+    bool LastIgnored = false;
     for (unsigned short I : Filter) {
       auto &MP = Matchers[I];
       if (EnableCheckProfiling)
         Timer.setBucket(&TimeByBucket[MP.second->getID()]);
       BoundNodesTreeBuilder Builder;
 
-      {
-        TraversalKindScope RAII(getASTContext(), MP.first.getTraversalKind());
-        if (getASTContext().getParentMapContext().traverseIgnored(DynNode) !=
-            DynNode)
-          continue;
+      std::optional<TraversalKind> TK = MP.first.getTraversalKind();
+      if (!HaveLastTraversal || TK != LastTraversalKind) {
+        TraversalKindScope RAII(getASTContext(), TK);
+        LastIgnored =
+            getASTContext().getParentMapContext().traverseIgnored(DynNode) !=
+            DynNode;
+        LastTraversalKind = TK;
+        HaveLastTraversal = true;
       }
+      if (LastIgnored)
+        continue;
 
       CurMatchRAII RAII(*this, MP.second, DynNode);
       if (MP.first.matches(DynNode, this, &Builder)) {
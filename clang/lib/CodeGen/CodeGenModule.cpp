@@ -3323,6 +3323,12 @@ void CodeGenModule::EmitDeferred() {
   if (DeferredDeclsToEmit.empty())
     return;
 
+  // FIXME: The bodies below are emitted one at a time. Emitting them
+  // concurrently needs more than a thread-safe LLVMContext: emitting a body
+  // mutates module-wide state (GetOrCreateLLVMFunction, the mangled-name and
+  // deferred-decl maps, vtable and RTTI emission), so those would have to be
+  // resolved up front or serialized while keeping this emission order.
+
   // Grab the list of decls to emit. If EmitGlobalDefinition schedules more
   // work, it will not interfere with this.
   std::vector<GlobalDecl> CurDeclsToEmit;
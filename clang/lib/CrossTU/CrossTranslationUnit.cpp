@@ -22,13 +22,14 @@
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Option/ArgList.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/LineIterator.h"
 #include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/YAMLParser.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/TargetParser/Triple.h"
 #include <algorithm>
-#include <fstream>
 #include <optional>
 #include <sstream>
 #include <tuple>
@@ -180,15 +181,20 @@ static bool parseCrossTUIndexItem(StringRef LineRef, StringRef &LookupName,
 
 llvm::Expected<llvm::StringMap<std::string>>
 parseCrossTUIndex(StringRef IndexPath) {
-  std::ifstream ExternalMapFile{std::string(IndexPath)};
+  // Read the whole index at once and scan it in place. Indexes of large
+  // projects have one line per external definition, and reading them line by
+  // line through a stream allocates a string per line.
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ExternalMapFile =
+      llvm::MemoryBuffer::getFile(IndexPath, /*IsText=*/true);
   if (!ExternalMapFile)
     return llvm::make_error<IndexError>(index_error_code::missing_index_file,
                                         IndexPath.str());
 
   llvm::StringMap<std::string> Result;
-  std::string Line;
-  unsigned LineNo = 1;
-  while (std::getline(ExternalMapFile, Line)) {
+  for (llvm::line_iterator I(**ExternalMapFile, /*SkipBlanks=*/false);
+       !I.is_at_eof(); ++I) {
+    StringRef Line = *I;
+    unsigned LineNo = I.line_number();
     // Split lookup name and file path
     StringRef LookupName, FilePathInIndex;
     if (!parseCrossTUIndexItem(Line, LookupName, FilePathInIndex))
@@ -205,8 +211,6 @@ parseCrossTUIndex(StringRef IndexPath) {
     if (!InsertionOccured)
       return llvm::make_error<IndexError>(
           index_error_code::multiple_definitions, IndexPath.str(), LineNo);
-
-    ++LineNo;
   }
   return Result;
 }
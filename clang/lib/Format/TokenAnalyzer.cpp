@@ -102,6 +102,13 @@ TokenAnalyzer::process(bool SkipAnnotation) {
   FormatTokenLexer Lex(Env.getSourceManager(), Env.getFileID(),
                        Env.getFirstStartColumn(), Style, Encoding, Allocator,
                        IdentTable);
+  // FIXME: The whole file is lexed, parsed and annotated on every call, even
+  // when only a few lines of it are affected. An incremental mode for editors
+  // would have to keep the unwrapped lines and annotations of a previous call
+  // and re-parse only the enclosing scopes of edited ranges, mapping the old
+  // token source locations into the new buffer. Preprocessor branches and
+  // macro expansions would also have to be tracked, because an edit to one
+  // can change how UnwrappedLineParser splits distant lines.
   ArrayRef<FormatToken *> Toks(Lex.lex());
   SmallVector<FormatToken *, 10> Tokens(Toks);
   UnwrappedLineParser Parser(Env.getSourceManager(), Style, Lex.getKeywords(),
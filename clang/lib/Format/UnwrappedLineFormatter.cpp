@@ -1269,6 +1269,10 @@ private:
   ///
   /// If \p DryRun is \c false, directly applies the changes.
   unsigned analyzeSolutionSpace(LineState &InitialState, bool DryRun) {
+    // FIXME: Every lookup compares whole ParenState stacks, which is costly in
+    // deeply nested lines. A hashed set is not a drop-in replacement, because
+    // once IgnoreStackForComparison is set on either side, two states compare
+    // equal regardless of their stacks, and no hash can respect that.
     std::set<LineState *, CompareLineStatePointers> Seen;
 
     // Increasing count of \c StateNode items we have created. This is used to
@@ -50,6 +50,13 @@
 #include <nmmintrin.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 using namespace clang;
 
 //===----------------------------------------------------------------------===//
@@ -2612,6 +2619,30 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
 
   char C;
   while (true) {
+#ifdef __SSE2__
+    // Skip 16 characters at a time while none of them is non-ASCII, a NUL or
+    // a newline; the byte loop below handles whatever stops this.
+    {
+      const char *Start = CurPtr;
+      const __m128i Zeros = _mm_setzero_si128();
+      const __m128i LFs = _mm_set1_epi8('\n');
+      const __m128i CRs = _mm_set1_epi8('\r');
+      while (CurPtr + 16 <= BufferEnd) {
+        __m128i V = _mm_loadu_si128((const __m128i *)CurPtr);
+        __m128i Stop = _mm_or_si128(
+            _mm_cmpeq_epi8(V, Zeros),
+            _mm_or_si128(_mm_cmpeq_epi8(V, LFs), _mm_cmpeq_epi8(V, CRs)));
+        unsigned Mask = _mm_movemask_epi8(_mm_or_si128(V, Stop));
+        if (Mask) {
+          CurPtr += llvm::countr_zero(Mask);
+          break;
+        }
+        CurPtr += 16;
+      }
+      if (CurPtr != Start)
+        UnicodeDecodingAlreadyDiagnosed = false;
+    }
+#endif
     C = *CurPtr;
     // Skip over characters in the fast loop.
     while (isASCII(C) && C != 0 &&   // Potentially EOF.
@@ -2850,13 +2881,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
@@ -11317,6 +11317,12 @@ void OverloadCandidateSet::CudaExcludeWrongSideCandidates(
 /// function, \p Best points to the candidate function found.
 ///
 /// \returns The result of overload resolution.
+///
+/// FIXME: Repeated calls with the same argument types (e.g. chains of
+/// operator<<) redo candidate collection and ranking each time. A per-TU
+/// cache of the result would have to be keyed on the lookup set as well as the
+/// argument types and value categories, because ADL, access, using-declarations
+/// and later redeclarations can each change the outcome between two calls.
 OverloadingResult OverloadCandidateSet::BestViableFunction(Sema &S,
                                                            SourceLocation Loc,
                                                            iterator &Best) {
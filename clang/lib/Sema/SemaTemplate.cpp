@@ -3638,6 +3638,11 @@ QualType Sema::CheckTemplateIdType(TemplateName Name,
     if (!AliasTemplate->getDeclContext()->isFileContext())
       SavedContext.emplace(*this, AliasTemplate->getDeclContext());
 
+    // FIXME: This substitution is redone for every use of the alias with the
+    // same arguments. Caching the canonical result per (alias, converted
+    // arguments) would have to be limited to successful substitutions, since
+    // a failure's diagnostics and SFINAE behavior depend on the context of
+    // the use, and the result is sugared with the arguments as written.
     CanonType =
         SubstType(Pattern->getUnderlyingType(), TemplateArgLists,
                   AliasTemplate->getLocation(), AliasTemplate->getDeclName());
@@ -8321,6 +8321,7 @@ Stmt *ASTReader::GetExternalDeclStmt(uint64_t Offset) {
 
   // Offset here is a global offset across the entire chain.
   RecordLocation Loc = getLocalBitOffset(Offset);
+  llvm::TimeTraceScope TimeScope("Deserialize Body", Loc.F->ModuleName);
   if (llvm::Error Err = Loc.F->DeclsCursor.JumpToBit(Loc.Offset)) {
     Error(std::move(Err));
     return nullptr;
@@ -8339,6 +8340,14 @@ bool ASTReader::LoadExternalSpecializationsImpl(SpecLookupTableTy &SpecLookups,
   if (It == SpecLookups.end())
     return false;
 
+  // Loading every specialization of a template defeats the hashed lookup
+  // below, so make it visible in -ftime-trace.
+  llvm::TimeTraceScope TimeScope("Load All Specializations", [&] {
+    if (const auto *ND = dyn_cast<NamedDecl>(D))
+      return ND->getQualifiedNameAsString();
+    return std::string();
+  });
+
   // Get Decl may violate the iterator from SpecializationsLookups so we store
   // the DeclIDs in ahead.
   llvm::SmallVector<serialization::reader::LazySpecializationInfo, 8> Infos =
@@ -8992,6 +9001,11 @@ IdentifierInfo *ASTReader::get(StringRef Name) {
   } else {
     // If there is a global index, look there first to determine which modules
     // provably do not have any results for this identifier.
+    //
+    // FIXME: Without a global index (it is disabled in many configurations),
+    // a miss probes every loaded module's identifier table. The hash is only
+    // computed once, but a per-module filter built when the module is loaded
+    // would turn most of those probes into a single bit test.
     GlobalModuleIndex::HitSet Hits;
     GlobalModuleIndex::HitSet *HitsPtr = nullptr;
     if (!loadGlobalIndex()) {
@@ -1242,6 +1242,12 @@ ASTWriter::createSignature() const {
 }
 
 ASTFileSignature ASTWriter::createSignatureForNamedModule() const {
+  // FIXME: This hashes the whole buffer, including encoded source locations.
+  // With a reduced BMI, non-inline function bodies are already omitted, but
+  // editing one still shifts the locations of every later declaration, so the
+  // signature changes even though the interface did not. A signature that
+  // importers can rely on for "interface unchanged" needs locations to be
+  // hashed in a line-insensitive form or excluded.
   llvm::SHA1 Hasher;
   Hasher.update(StringRef(Buffer.data(), Buffer.size()));
 
@@ -6183,6 +6189,11 @@ void ASTWriter::WriteDeclAndTypes(ASTContext &Context) {
   DeclTypesBlockStartOffset = Stream.GetCurrentBitNo();
   WriteTypeAbbrevs();
   WriteDeclAbbrevs();
+  // FIXME: Decls and types are encoded one at a time into the single output
+  // Stream. Encoding them in parallel is not just a matter of per-thread
+  // buffers: writing a record assigns IDs to, and enqueues, every decl and
+  // type it references (GetDeclRef/GetOrCreateTypeID), so the ID numbering,
+  // and therefore the output, depend on this serial order.
   do {
     WriteDeclUpdatesBlocks(Context, DeclUpdatesOffsetsRecord);
     while (!DeclTypesToEmit.empty()) {
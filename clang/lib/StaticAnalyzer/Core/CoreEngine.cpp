@@ -48,6 +48,8 @@ STAT_COUNTER(NumCTUSteps, "The # of CTU steps executed.");
 ALWAYS_ENABLED_STATISTIC(NumReachedMaxSteps,
                          "The # of times we reached the max number of steps.");
 STAT_COUNTER(NumPathsExplored, "The # of paths explored by the analyzer.");
+STAT_MAX(MaxExplodedGraphSize,
+         "The maximum # of live nodes in an exploded graph.");
 
 //===----------------------------------------------------------------------===//
 // Core analysis engine.
@@ -175,6 +177,10 @@ bool CoreEngine::ExecuteWorkList(const LocationContext *L, unsigned MaxSteps,
     NumCTUSteps += CTUSteps;
   }
 
+  // Reclaimed nodes are not counted, so this is the graph that is kept alive
+  // for bug report construction.
+  MaxExplodedGraphSize.updateMax(G.size());
+
   ExprEng.processEndWorklist();
   return WList->hasWork();
 }
@@ -473,6 +473,14 @@ void AnalysisConsumer::HandleDeclsCallGraph(const unsigned LocalTUDeclsSize) {
   // inlined functions. The topological order allows the "do not reanalyze
   // previously inlined function" performance heuristic to be triggered more
   // often.
+  //
+  // FIXME: This loop is inherently sequential. Both the set of functions that
+  // get analyzed as top level (Visited) and the inlining mode of each one
+  // depend on the functions analyzed before it. Analyzing top-level functions
+  // on several threads would also need per-thread ExprEngine instances and
+  // FunctionSummaries, bug reports emitted in a deterministic order, and an
+  // ASTContext that is safe to use concurrently, which it currently is not
+  // (e.g. lazy deserialization from a PCH or CTU imports).
   SetOfConstDecls Visited;
   SetOfConstDecls VisitedAsTopLevel;
   llvm::ReversePostOrderTraversal<clang::CallGraph*> RPOT(&CG);
@@ -750,6 +750,14 @@ ModuleDepCollectorPP::handleTopLevelModule(const Module *M) {
   if (auto ModI = MDC.ModularDeps.find(M); ModI != MDC.ModularDeps.end())
     return ModI->second->ID;
 
+  // FIXME: ModularDeps only lives as long as this TU. Other TUs importing the
+  // same module will compute the same ModuleDeps again below. Reusing them
+  // across TUs in a DependencyScanningService is not simple, because the
+  // context hash that would key the cache is computed last, from the build
+  // invocation derived from this TU's invocation. The key would have to be
+  // checked ahead of time, or existing entries validated against this TU.
+  // The consumers' AlreadySeen sets only remove duplicates from the output.
+
   auto OwnedMD = std::make_unique<ModuleDeps>();
   ModuleDeps &MD = *OwnedMD;
 
@@ -0,0 +1,36 @@
+// RUN: %clang_cc1 -fsyntax-only -Wcomment -Winvalid-utf8 -verify %s
+
+// Line comments are skipped 16 bytes at a time where the host supports it.
+// Check the bytes that end a comment when they land on either side of a
+// 16-byte chunk boundary, counted from the first byte after the "//", and
+// a comment at the end of the buffer that is shorter than one chunk.
+
+//xxxxxxxxxxxxxxx
+int a15;
+//xxxxxxxxxxxxxxxx
+int a16;
+//xxxxxxxxxxxxxxxxx
+int a17;
+//xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+int a31;
+//xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+int a32;
+//xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+int a33;
+
+// A backslash ending the first chunk escapes the newline starting the next.
+// expected-warning@+1 {{multi-line // comment}}
+//xxxxxxxxxxxxxxx\
+int swallowed;
+int swallowed;
+
+// Non-ASCII bytes on a chunk boundary are still validated.
+// expected-warning@+1 {{invalid UTF-8 in comment}}
+//xxxxxxxxxxxxxxxx
+//xxxxxxxxxxxxxxxxé
+int b;
+
+int sum = a15 + a16 + a17 + a31 + a32 + a33 + swallowed + b;
+
+// This comment ends the file without a newline.
+//tail
\ No newline at end of file
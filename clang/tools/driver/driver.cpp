@@ -367,6 +367,11 @@ int clang_main(int Argc, char **Argv, const llvm::ToolContext &ToolContext) {
       [&ToolContext](SmallVectorImpl<const char *> &ArgV) {
         return ExecuteCC1Tool(ArgV, ToolContext);
       };
+  // Running cc1 in-process already avoids a second exec and dynamic link per
+  // job. A long-lived server that also amortized target registration and
+  // option parsing across invocations would need cc1 to be re-entrant, which
+  // it currently is not: cl::opt values and LLVM's global state (see the
+  // usage-count reset in ExecuteCC1Tool) leak from one job into the next.
   if (!UseNewCC1Process) {
     TheDriver.CC1Main = ExecuteCC1WithContext;
     // Ensure the CC1Command actually catches cc1 crashes
@@ -607,6 +607,11 @@ struct Allocator {
     m->SetUsedSize(size);
     m->user_requested_alignment_log = user_requested_alignment_log;
 
+    // StackDepotPut() finds already-seen stacks without taking a lock, so the
+    // per-allocation cost is dominated by unwinding. Keep it low with
+    // fast_unwind_on_malloc=1 and a small malloc_context_size.
+    // FIXME: A per-thread cache keyed by the caller PC could skip the depot
+    // lookup, but a PC alone does not identify the full trace.
     m->SetAllocContext(t ? t->tid() : kMainTid, StackDepotPut(*stack));
 
     if (!from_primary || *(u8 *)MEM_TO_SHADOW((uptr)allocated) == 0) {
@@ -256,13 +256,18 @@ ContextNode *getFlatProfile(FunctionData &Data, void *Callee, GUID Guid,
 // first context.
 void setupContext(ContextRoot *Root, GUID Guid, uint32_t NumCounters,
                   uint32_t NumCallsites) {
+  // Allocate (and zero) the arena before taking the global lock, so threads
+  // setting up different roots at the same time don't serialize on it. A
+  // thread that loses the race for the same root frees its arena.
+  const auto Needed = ContextNode::getAllocSize(NumCounters, NumCallsites);
+  auto *M = Arena::allocateNewArena(getArenaAllocSize(Needed));
   __sanitizer::GenericScopedLock<__sanitizer::SpinMutex> Lock(
       &AllContextsMutex);
   // Re-check - we got here without having had taken a lock.
-  if (Root->FirstMemBlock)
+  if (Root->FirstMemBlock) {
+    Arena::freeArenaList(M);
     return;
-  const auto Needed = ContextNode::getAllocSize(NumCounters, NumCallsites);
-  auto *M = Arena::allocateNewArena(getArenaAllocSize(Needed));
+  }
   Root->FirstMemBlock = M;
   Root->CurrentMem = M;
   Root->FirstNode = allocContextNode(M->tryBumpAllocate(Needed), Guid,
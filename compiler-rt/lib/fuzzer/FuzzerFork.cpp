@@ -196,6 +196,12 @@ struct GlobalEnv {
     return Job;
   }
 
+  // FIXME: Jobs are merged one at a time on the main thread, and every job
+  // with a candidate input pays for a CrashResistantMerge subprocess and a
+  // round trip of its corpus and feature files through TempDir. With many
+  // workers this serial step limits scaling. Workers could instead publish
+  // new features into a bitmap in shared memory and skip inputs whose
+  // features are already set, leaving the merge only for real candidates.
   void RunOneMergeJob(FuzzJob *Job) {
     auto Stats = ParseFinalStatsFromLog(Job->LogPath);
     NumRuns += Stats.number_of_executed_units;
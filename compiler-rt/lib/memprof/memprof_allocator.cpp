@@ -476,6 +476,11 @@ struct Allocator {
 
     m->cpu_id = GetCpuId();
     m->timestamp_ms = GetTimestamp();
+    // FIXME: Every allocation is profiled. A production sampling mode would
+    // record the context for only a Poisson-sampled subset, by drawing the
+    // number of bytes to the next sampled allocation, and would also need
+    // the instrumentation to skip the shadow updates for unsampled memory;
+    // otherwise the per-access cost remains.
     m->alloc_context_id = StackDepotPut(*stack);
 
     uptr size_rounded_down_to_granularity =
@@ -64,6 +64,11 @@ typedef struct COMPILER_RT_ALIGNAS(INSTR_PROF_DATA_ALIGNMENT)
  * \brief Return 1 if profile counters are continuously synced to the raw
  * profile via an mmap(). This is in contrast to the default mode, in which
  * the raw profile is written out at program exit time.
+ *
+ * Because the counters live in the mapped file, a long-running process can be
+ * sampled by copying its raw profile at any time, without calling
+ * \a __llvm_profile_dump() or relying on exit hooks. The copy is not an atomic
+ * snapshot: counters keep being updated while it is taken.
  */
 int __llvm_profile_is_continuous_mode_enabled(void);
 
@@ -425,6 +425,10 @@ void ParseSymbolizeFrameOutput(const char *str,
   }
 }
 
+// FIXME: Every frame is a separate round trip to llvm-symbolizer, and nothing
+// is remembered across reports or processes. Sending all frames of a stack in
+// one request, and caching the replies keyed by module build ID and offset,
+// would avoid re-symbolizing the same frames in report-heavy test suites.
 bool LLVMSymbolizer::SymbolizePC(uptr addr, SymbolizedStack *stack) {
   AddressInfo *info = &stack->info;
   const char *buf = FormatAndSendCommand(
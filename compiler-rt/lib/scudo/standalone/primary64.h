@@ -1332,6 +1332,11 @@ private:
     // ==================================================================== //
     // 4. Release the unused physical pages back to the OS.
     // ==================================================================== //
+    // FIXME: Pages are released at base page granularity, which splits any
+    // transparent huge page backing the region. A huge page aware mode would
+    // madvise the region with MADV_HUGEPAGE when mapping it and only hand the
+    // recorder ranges that cover whole huge pages. Partially free huge pages
+    // would stay resident, costing RSS but keeping the TLB footprint small.
     RegionReleaseRecorder<MemMapT> Recorder(&Region->MemMapInfo.MemMap,
                                             Region->RegionBeg,
                                             Context.getReleaseOffset());
@@ -133,6 +133,13 @@ struct TSDRegistrySharedT {
   }
 
 private:
+  // The number of TSDs is bounded by the number of CPUs, so the cache
+  // footprint does not grow with the number of threads. Threads are bound to
+  // a TSD round-robin and only migrate when tryLock() fails.
+  // FIXME: On Linux, the CPU number published through rseq could select the
+  // TSD directly, which would keep a thread on the cache of the CPU it runs on
+  // and make contention rare. Dropping the lock altogether, as per-CPU caches
+  // do elsewhere, would also need the cache operations to be restartable.
   ALWAYS_INLINE TSD<Allocator> *getTSDAndLock() NO_THREAD_SAFETY_ANALYSIS {
     TSD<Allocator> *TSD = getCurrentTSD();
     DCHECK(TSD);
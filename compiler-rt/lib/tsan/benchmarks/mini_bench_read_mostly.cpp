@@ -0,0 +1,74 @@
+// Mini-benchmark for tsan: read-mostly shared data.
+// Many threads repeatedly scan a shared table under a reader lock while one
+// thread occasionally updates it under the writer lock. Repeated reads within
+// the same epoch are filtered by ContainsSameAccess and do not store shadow,
+// but once more threads than kShadowCnt read the same location they keep
+// evicting each other's shadow cells, so the shadow cache lines bounce
+// between cores. Compare n_threads <= 4 against larger values.
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int len;
+int *a;
+const int kNumIter = 1000;
+const int kScansPerLock = 16;
+pthread_rwlock_t lock = PTHREAD_RWLOCK_INITIALIZER;
+
+__attribute__((noinline))
+long Scan() {
+  long sum = 0;
+  for (int i = 0, n = len; i < n; i++)
+    sum += a[i];
+  return sum;
+}
+
+void *Reader(void *arg) {
+  long idx = (long)arg;
+  long sum = 0;
+  for (int i = 0; i < kNumIter; i++) {
+    pthread_rwlock_rdlock(&lock);
+    for (int j = 0; j < kScansPerLock; j++)
+      sum += Scan();
+    pthread_rwlock_unlock(&lock);
+  }
+  printf("Thread %ld done (%ld)\n", idx, sum);
+  return 0;
+}
+
+void *Writer(void *arg) {
+  for (int i = 0; i < kNumIter / 10; i++) {
+    pthread_rwlock_wrlock(&lock);
+    a[i % len]++;
+    pthread_rwlock_unlock(&lock);
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  int n_threads = 0;
+  if (argc != 3) {
+    n_threads = 8;
+    len = 10000;
+  } else {
+    n_threads = atoi(argv[1]);
+    assert(n_threads > 0 && n_threads <= 64);
+    len = atoi(argv[2]);
+    assert(len > 0);
+  }
+  printf("%s: n_threads=%d len=%d iter=%d\n",
+         __FILE__, n_threads, len, kNumIter);
+  a = new int[len];
+  for (int i = 0, n = len; i < n; i++)
+    a[i] = i;
+  pthread_t *t = new pthread_t[n_threads + 1];
+  for (int i = 0; i < n_threads; i++)
+    pthread_create(&t[i], 0, Reader, (void*)(long)i);
+  pthread_create(&t[n_threads], 0, Writer, 0);
+  for (int i = 0; i <= n_threads; i++)
+    pthread_join(t[i], 0);
+  delete [] t;
+  delete [] a;
+  return 0;
+}
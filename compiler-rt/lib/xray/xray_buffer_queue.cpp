@@ -158,6 +158,13 @@ BufferQueue::BufferQueue(size_t B, size_t N,
   Success = init(B, N) == BufferQueue::ErrorCode::Ok;
 }
 
+// Each thread in FDR mode writes records into a buffer it owns and only comes
+// back here once that buffer is full, so the spin lock is taken once per
+// buffer rather than once per record.
+// FIXME: Buffers released here are only written out by the flush at
+// finalize(). A streaming mode would need this release path to hand full
+// buffers to a consumer and recycle them, instead of retiring them until the
+// next generation.
 BufferQueue::ErrorCode BufferQueue::getBuffer(Buffer &Buf) {
   if (atomic_load(&Finalizing, memory_order_acquire))
     return ErrorCode::QueueFinalizing;
@@ -469,12 +469,12 @@ static RT_API_ATTRS bool UnformattedDescriptorIO(IoStatementState &io,
                            : childUnf->Receive(&x, totalBytes, swappingBytes);
       }
     }};
-    bool swapEndianness{externalUnf && externalUnf->unit().swapEndianness()};
-    if (!swapEndianness &&
-        descriptor.IsContiguous()) { // contiguous unformatted I/O
+    if (descriptor.IsContiguous()) { // contiguous unformatted I/O
+      // Byte swapping, if enabled, is applied per swappingBytes unit by the
+      // unit's Emit()/Receive(), so the whole array can go in one transfer.
       char &x{ExtractElement<char>(io, descriptor, subscripts)};
       return Transfer(x, numElements * elementBytes);
-    } else { // non-contiguous or byte-swapped intrinsic type unformatted I/O
+    } else { // non-contiguous intrinsic type unformatted I/O
       for (std::size_t j{0}; j < numElements; ++j) {
         char &x{ExtractElement<char>(io, descriptor, subscripts)};
         if (!Transfer(x, elementBytes)) {
@@ -69,10 +69,14 @@ private:
 //   DO 1 I = 1, NROWS
 //    DO 1 J = 1, NCOLS
 //   1 RES(I,J) = 0
-//   DO 2 K = 1, N
-//    DO 2 J = 1, NCOLS
+//   DO 2 J = 1, NCOLS
+//    DO 2 K = 1, N
 //     DO 2 I = 1, NROWS
 //   2  RES(I,J) = RES(I,J) + X(I,K)*Y(K,J) ! loop-invariant last term
+// Keeping J outermost (as the reference BLAS GEMM does) means that only one
+// result column is updated by the two inner loops, so it stays in cache
+// rather than the whole result being streamed through once per K.  Each
+// result element still accumulates its terms in increasing K order.
 template <TypeCategory RCAT, int RKIND, typename XT, typename YT,
     bool X_HAS_STRIDED_COLUMNS, bool Y_HAS_STRIDED_COLUMNS>
 inline RT_API_ATTRS void MatrixTimesMatrix(
@@ -82,27 +86,29 @@ inline RT_API_ATTRS void MatrixTimesMatrix(
     std::size_t yColumnByteStride = 0) {
   using ResultType = CppTypeFor<RCAT, RKIND>;
   std::memset(product, 0, rows * cols * sizeof *product);
-  const XT *RESTRICT xp0{x};
-  for (SubscriptValue k{0}; k < n; ++k) {
-    ResultType *RESTRICT p{product};
-    for (SubscriptValue j{0}; j < cols; ++j) {
+  for (SubscriptValue j{0}; j < cols; ++j) {
+    ResultType *RESTRICT p0{product + j * rows};
+    const YT *RESTRICT yp;
+    if constexpr (!Y_HAS_STRIDED_COLUMNS) {
+      yp = y + j * n;
+    } else {
+      yp = reinterpret_cast<const YT *>(
+          reinterpret_cast<const char *>(y) + j * yColumnByteStride);
+    }
+    const XT *RESTRICT xp0{x};
+    for (SubscriptValue k{0}; k < n; ++k) {
+      ResultType *RESTRICT p{p0};
       const XT *RESTRICT xp{xp0};
-      ResultType yv;
-      if constexpr (!Y_HAS_STRIDED_COLUMNS) {
-        yv = static_cast<ResultType>(y[k + j * n]);
-      } else {
-        yv = static_cast<ResultType>(reinterpret_cast<const YT *>(
-            reinterpret_cast<const char *>(y) + j * yColumnByteStride)[k]);
-      }
+      ResultType yv{static_cast<ResultType>(yp[k])};
       for (SubscriptValue i{0}; i < rows; ++i) {
         *p++ += static_cast<ResultType>(*xp++) * yv;
       }
-    }
-    if constexpr (!X_HAS_STRIDED_COLUMNS) {
-      xp0 += rows;
-    } else {
-      xp0 = reinterpret_cast<const XT *>(
-          reinterpret_cast<const char *>(xp0) + xColumnByteStride);
+      if constexpr (!X_HAS_STRIDED_COLUMNS) {
+        xp0 += rows;
+      } else {
+        xp0 = reinterpret_cast<const XT *>(
+            reinterpret_cast<const char *>(xp0) + xColumnByteStride);
+      }
     }
   }
 }
@@ -11,6 +11,13 @@
 // Real and complex SUM reductions attempt to reduce floating-point
 // cancellation on intermediate results by using "Kahan summation"
 // (basically the same as manual "double-double").
+//
+// FIXME: Total reductions visit elements one at a time through
+// AccumulateAt(), so even contiguous arrays are neither vectorized nor
+// split across threads. A contiguous fast path in DoTotalReduction could
+// hand blocks of elements to the accumulators, but the Kahan correction is
+// a serial dependence: blocked or threaded partial sums would change the
+// result unless the blocking is fixed independently of the thread count.
 
 #include "flang-rt/runtime/reduction-templates.h"
 #include "flang/Common/float128.h"
@@ -34,12 +34,19 @@
 #include "mlir/Pass/PassManager.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "llvm/ADT/TypeSwitch.h"
+#include "llvm/Support/CommandLine.h"
 
 namespace hlfir {
 #define GEN_PASS_DEF_BUFFERIZEHLFIR
 #include "flang/Optimizer/HLFIR/Passes.h.inc"
 } // namespace hlfir
 
+static llvm::cl::opt<bool> reportArrayTemps(
+    "flang-report-array-temps",
+    llvm::cl::desc("Emit a remark for each array temporary created for an "
+                   "hlfir.elemental during bufferization"),
+    llvm::cl::init(false));
+
 namespace {
 
 /// Helper to create tuple from a bufferized expr storage and clean up
@@ -127,6 +134,10 @@ createArrayTemp(mlir::Location loc, fir::FirOpBuilder &builder,
       polymorphicMold ? polymorphicMold->getFirBase() : nullptr);
   hlfir::Entity temp = hlfir::Entity{base};
   assert(!temp.isAllocatable() && "temp must have been allocated");
+  if (reportArrayTemps)
+    mlir::emitRemark(loc) << "array temporary of type " << sequenceType
+                          << " allocated on the "
+                          << (isHeapAlloc ? "heap" : "stack");
   return {temp, builder.createBool(loc, isHeapAlloc)};
 }
 
@@ -0,0 +1,124 @@
+//===-- Benchmark qsort and strtod against the host libc ------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "src/__support/macros/config.h"
+#include "benchmark/benchmark.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace LIBC_NAMESPACE_DECL {
+extern void qsort(void *array, size_t array_size, size_t elem_size,
+                  int (*compare)(const void *, const void *));
+extern double strtod(const char *__restrict str, char **__restrict str_end);
+} // namespace LIBC_NAMESPACE_DECL
+
+using QsortFn = void (*)(void *, size_t, size_t,
+                         int (*)(const void *, const void *));
+using StrtodFn = double (*)(const char *, char **);
+
+namespace {
+
+// An element of ELEM_SIZE bytes, ordered by its leading min(ELEM_SIZE, 8)-byte
+// key.
+template <size_t ELEM_SIZE> struct Element {
+  static_assert(ELEM_SIZE >= sizeof(uint32_t));
+  unsigned char Bytes[ELEM_SIZE];
+};
+
+template <size_t ELEM_SIZE> int compareElements(const void *A, const void *B) {
+  uint64_t KeyA = 0, KeyB = 0;
+  constexpr size_t KeySize =
+      ELEM_SIZE < sizeof(uint64_t) ? ELEM_SIZE : sizeof(uint64_t);
+  std::memcpy(&KeyA, A, KeySize);
+  std::memcpy(&KeyB, B, KeySize);
+  return KeyA < KeyB ? -1 : KeyA > KeyB;
+}
+
+template <size_t ELEM_SIZE>
+std::vector<Element<ELEM_SIZE>> makeRandomElements(size_t Count) {
+  std::mt19937_64 Generator(Count);
+  std::vector<Element<ELEM_SIZE>> Elements(Count);
+  for (auto &E : Elements)
+    for (auto &Byte : E.Bytes)
+      Byte = static_cast<unsigned char>(Generator());
+  return Elements;
+}
+
+// Decimals with few significant digits and small exponents, which is what
+// most text formats contain.
+std::vector<std::string> makeShortDecimals(size_t Count) {
+  std::mt19937_64 Generator(Count);
+  std::uniform_int_distribution<int> Mantissa(0, 999999);
+  std::uniform_int_distribution<int> Exponent(-8, 8);
+  std::vector<std::string> Strings;
+  Strings.reserve(Count);
+  char Buffer[32];
+  for (size_t I = 0; I != Count; ++I) {
+    std::snprintf(Buffer, sizeof(Buffer), "%d.%03de%d", Mantissa(Generator),
+                  Mantissa(Generator) % 1000, Exponent(Generator));
+    Strings.emplace_back(Buffer);
+  }
+  return Strings;
+}
+
+} // namespace
+
+// Pausing the timer costs far more than sorting a small array, so the input is
+// restored for a whole batch of iterations at once: the batch holds about
+// kBatchElements elements, and only arrays at least that large pay for a pause
+// on every iteration.
+constexpr size_t kBatchElements = 1 << 16;
+
+template <size_t ELEM_SIZE>
+static void BM_Qsort(benchmark::State &State, QsortFn Qsort) {
+  const size_t Count = State.range(0);
+  const auto Input = makeRandomElements<ELEM_SIZE>(Count);
+  const size_t BatchSize = Count < kBatchElements ? kBatchElements / Count : 1;
+  std::vector<Element<ELEM_SIZE>> Batch(BatchSize * Count);
+  size_t Next = BatchSize;
+  for (auto _ : State) {
+    if (Next == BatchSize) {
+      State.PauseTiming();
+      for (size_t I = 0; I != BatchSize; ++I)
+        std::copy(Input.begin(), Input.end(), Batch.begin() + I * Count);
+      Next = 0;
+      State.ResumeTiming();
+    }
+    auto *Elements = Batch.data() + Next++ * Count;
+    Qsort(Elements, Count, ELEM_SIZE, compareElements<ELEM_SIZE>);
+    benchmark::DoNotOptimize(Elements);
+  }
+  State.SetItemsProcessed(State.iterations() * Count);
+}
+
+static void BM_StrtodShort(benchmark::State &State, StrtodFn Strtod) {
+  const auto Strings = makeShortDecimals(1024);
+  for (auto _ : State)
+    for (const auto &S : Strings)
+      benchmark::DoNotOptimize(Strtod(S.c_str(), nullptr));
+  State.SetItemsProcessed(State.iterations() * Strings.size());
+}
+
+#define QSORT_BENCHMARKS(SIZE)                                                 \
+  BENCHMARK_CAPTURE(BM_Qsort<SIZE>, llvm_libc, LIBC_NAMESPACE::qsort)          \
+      ->Range(1 << 8, 1 << 18);                                                \
+  BENCHMARK_CAPTURE(BM_Qsort<SIZE>, host, ::qsort)->Range(1 << 8, 1 << 18)
+
+QSORT_BENCHMARKS(4);
+QSORT_BENCHMARKS(8);
+QSORT_BENCHMARKS(16);
+QSORT_BENCHMARKS(24);
+
+BENCHMARK_CAPTURE(BM_StrtodShort, llvm_libc, LIBC_NAMESPACE::strtod);
+BENCHMARK_CAPTURE(BM_StrtodShort, host, ::strtod);
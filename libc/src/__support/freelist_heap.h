@@ -31,6 +31,9 @@ using cpp::span;
 
 LIBC_INLINE constexpr bool IsPow2(size_t x) { return x && (x & (x - 1)) == 0; }
 
+// A single-threaded heap over one contiguous region, meant for baremetal
+// targets. It has no size classes or thread caches; hosted full builds get a
+// scalable malloc by configuring with LLVM_LIBC_INCLUDE_SCUDO=ON instead.
 class FreeListHeap {
 public:
   constexpr FreeListHeap() : begin(&_end), end(&__llvm_libc_heap_limit) {}
@@ -411,6 +411,10 @@ void unsynchronized_pool_resource::do_deallocate(void* p, size_t bytes, size_t a
   }
 }
 
+// TODO: synchronized_pool_resource serializes every allocation and deallocation on one mutex around an
+// unsynchronized_pool_resource. Per-thread caches of free blocks, returned to the shared pools in batches, would
+// remove that contention, but the mutex and the wrapped pool are part of the class layout (and therefore the ABI),
+// so this would have to be done behind an ABI flag.
 bool synchronized_pool_resource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
 
 // 23.12.6, mem.res.monotonic.buffer
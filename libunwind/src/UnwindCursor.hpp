@@ -1660,6 +1660,11 @@ bool UnwindCursor<A, R>::getInfoFromFdeCie(
     const typename CFI_Parser<A>::FDE_Info &fdeInfo,
     const typename CFI_Parser<A>::CIE_Info &cieInfo, pint_t pc,
     uintptr_t dso_base) {
+  // FIXME: The CFI interpreted here is decoded and interpreted again by
+  // DwarfInstructions::stepWithDwarf() for the same pc, and nothing is kept
+  // across unwinds. Keeping the resulting PrologInfo, either in the cursor
+  // (which has to fit in unw_cursor_t) or in a process-wide cache keyed by
+  // pc and flushed like DwarfFDECache on dlclose, would avoid both.
   typename CFI_Parser<A>::PrologInfo prolog;
   if (CFI_Parser<A>::parseFDEInstructions(_addressSpace, fdeInfo, cieInfo, pc,
                                           R::getArch(), &prolog)) {
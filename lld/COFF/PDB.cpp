@@ -1160,6 +1160,12 @@ void PDBLinker::addObjectsToPDB() {
       tMerger.mergeTypesWithGHash();
 
     // Merge dependencies and then regular objects.
+    //
+    // FIXME: Symbol records are remapped and appended to their module streams
+    // one object at a time. Remapping could run per module in parallel, since
+    // with ghashes the type index maps are complete at this point. The writes
+    // into the shared string table and publics/globals would still need to be
+    // added in object order to keep the PDB deterministic.
     {
       llvm::TimeTraceScope timeScope("Merge debug info (dependencies)");
       for (TpiSource *source : tMerger.dependencySources)
@@ -497,6 +497,12 @@ template <class ELFT> void ICF<ELFT>::run() {
   // Perform 2 rounds of relocation hash propagation. 2 is an empirical value to
   // reduce the average sizes of equivalence classes, i.e. segregate() which has
   // a large time complexity will have less work to do.
+  //
+  // FIXME: combineRelocHashes sums the targets' classes, so it ignores
+  // relocation order, offsets and types, and it can't tell apart sections
+  // whose targets are permuted. A stronger, order-sensitive combination would
+  // leave segregate() smaller classes, but these hashes also decide the order
+  // of the classes and so of --print-icf-sections output.
   for (unsigned cnt = 0; cnt != 2; ++cnt) {
     parallelForEach(sections, [&](InputSection *s) {
       const RelsOrRelas<ELFT> rels = s->template relsOrRelas<ELFT>();
@@ -350,6 +350,14 @@ doParseFiles(Ctx &ctx,
   // Add all files to the symbol table. This will add almost all symbols that we
   // need to the symbol table. This process might add files to the link due to
   // addDependentLibrary.
+  //
+  // FIXME: This loop is serial because resolution depends on command-line
+  // order: which definition wins, which archive member is fetched by a lazy
+  // symbol, and which files addDependentLibrary appends all depend on the
+  // files before. Section and local symbol setup already runs in parallel
+  // later (initSectionsAndLocalSyms, postParse). Resolving global symbols in
+  // parallel would need a sharded symbol table that breaks ties by file
+  // priority, plus a way to replay lazy fetches deterministically.
   for (size_t i = 0; i < files.size(); ++i) {
     llvm::TimeTraceScope timeScope("Parse input files", files[i]->getName());
     doParseFile<ELFT>(ctx, files[i].get());
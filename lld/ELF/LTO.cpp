@@ -368,6 +368,11 @@ SmallVector<std::unique_ptr<InputFile>, 0> BitcodeCompiler::compile() {
   bool savePrelink = ctx.arg.saveTempsArgs.contains("prelink");
   SmallVector<std::unique_ptr<InputFile>, 0> ret;
   const char *ext = ctx.arg.ltoEmitAsm ? ".s" : ".o";
+  // Backend output is already in memory (buf) or mapped from the cache
+  // (files); nothing is written to disk unless --save-temps or
+  // --lto-obj-path asks for it. The objects are wrapped only after every
+  // backend has finished because createObjFile and the later symbol
+  // resolution are not thread-safe and their order must match task order.
   for (unsigned i = 0; i != maxTasks; ++i) {
     StringRef bitcodeFilePath;
     StringRef objBuf;
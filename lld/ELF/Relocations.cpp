@@ -1696,6 +1696,12 @@ template <class ELFT> void elf::scanRelocations(Ctx &ctx) {
   // Deterministic parallellism needs sorting relocations which is unsuitable
   // for -z nocombreloc. MIPS and PPC64 use global states which are not suitable
   // for parallelism.
+  //
+  // GOT, PLT and TLS needs are recorded as symbol flags here and materialized
+  // in a serial pass afterwards (postScanRelocations), so other targets need
+  // no per-thread staging. FIXME: The MIPS GOT (MipsGotSection::addEntry) and
+  // the PPC64 TOC/long-branch bookkeeping would have to be converted to the
+  // same scheme before they can be scanned in parallel.
   bool serial = !ctx.arg.zCombreloc || ctx.arg.emachine == EM_MIPS ||
                 ctx.arg.emachine == EM_PPC64;
   parallel::TaskGroup tg;
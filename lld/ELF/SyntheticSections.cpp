@@ -3958,7 +3958,14 @@ void MergeTailSection::writeTo(uint8_t *buf) { builder.write(buf); }
 
 void MergeTailSection::finalizeContents() {
   // Add all string pieces to the string table builder to create section
-  // contents.
+  // contents. getData() carries the piece hash computed at split time, so
+  // strings are not hashed again.
+  //
+  // FIXME: Unlike MergeNoTailSection, this is single-threaded: the builder
+  // suffix-sorts all strings of the output section at once (multikey
+  // quicksort). Tail merging could be sharded by the last character before
+  // the terminator, because a string can only be a suffix of strings that
+  // end the same way; empty strings would still need special handling.
   for (MergeInputSection *sec : sections)
     for (size_t i = 0, e = sec->pieces.size(); i != e; ++i)
       if (sec->pieces[i].live)
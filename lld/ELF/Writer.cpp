@@ -2926,6 +2926,12 @@ template <class ELFT> void Writer<ELFT>::openFile() {
     return;
   }
 
+  // FIXME: The output is always written from scratch. An incremental mode
+  // would have to keep the previous output open instead of unlinking it, and
+  // keep a record of its layout: each input section's address and hash, and
+  // the slack left in each output section. Then only changed sections would be
+  // rewritten, every relocation that refers to them would be reapplied, and a
+  // changed layout would fall back to a full link.
   unlinkAsync(ctx.arg.outputFile);
   unsigned flags = 0;
   if (!ctx.arg.relocatable)
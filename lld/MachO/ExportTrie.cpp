@@ -265,6 +265,11 @@ tailcall:
   }
 }
 
+// FIXME: This runs on one thread, though the __LINKEDIT sections are already
+// finalized in parallel with each other. Subtrees could be built in parallel
+// once the top-level partition is done, but makeNode() appends to `nodes`,
+// whose order is the serialization order. Parallel subtree building would need
+// per-task node lists concatenated in the serial order.
 size_t TrieBuilder::build() {
   if (exported.empty())
     return 0;
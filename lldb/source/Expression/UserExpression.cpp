@@ -252,6 +252,11 @@ UserExpression::Evaluate(ExecutionContext &exe_ctx,
       language = frame->GetLanguage();
   }
 
+  // FIXME: every evaluation parses the expression from scratch. Breakpoint
+  // conditions avoid this by keeping their UserExpression around while
+  // IsParseCacheable() and MatchesContext() hold (see
+  // BreakpointLocation::ConditionSaysStop); a per-target cache keyed on the
+  // expression text, prefix, language and options could do the same here.
   Status error;
   lldb::UserExpressionSP user_expression_sp(
       target->GetUserExpressionForLanguage(
@@ -2669,6 +2669,12 @@ size_t ProcessGDBRemote::DoReadMemory(addr_t addr, void *buf, size_t size,
     size = max_memory_size;
   }
 
+  // FIXME: every call costs one synchronous round trip. Process's MemoryCache
+  // already rounds small reads up to memory-cache-line-size, but unwinding and
+  // value formatting still touch many unrelated lines per stop. Batching them
+  // would need a multi-range read packet in lldb-server and a way for callers
+  // to submit several ranges at once; GDBRemoteCommunication only supports a
+  // single outstanding request today.
   char packet[64];
   int packet_len;
   packet_len = ::snprintf(packet, sizeof(packet), "%c%" PRIx64 ",%" PRIx64,
@@ -2263,6 +2263,12 @@ bool DWARFASTParserClang::CompleteTypeFromDWARF(
     const CompilerType &clang_type) {
   SymbolFileDWARF *dwarf = die.GetDWARF();
 
+  // FIXME: completion could be done ahead of time for the types of the
+  // selected frame's locals, but only under this module lock: the
+  // clang::ASTContext behind m_ast is not thread-safe, and an import into the
+  // expression AST may be reading the same decls. Background precompletion
+  // would therefore serialize with the foreground and gain little until
+  // TypeSystemClang has finer-grained locking.
   std::lock_guard<std::recursive_mutex> guard(
       dwarf->GetObjectFile()->GetModule()->GetMutex());
 
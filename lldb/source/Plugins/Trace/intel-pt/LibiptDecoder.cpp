@@ -566,6 +566,11 @@ Error lldb_private::trace_intel_pt::DecodeSingleTraceForThread(
   if (!blocks)
     return blocks.takeError();
 
+  // FIXME: each PSB block is decoded independently of the others, as it only
+  // needs the starting ip of the next block, so the blocks could be decoded
+  // concurrently. They all append to the single DecodedThread though, which
+  // would have to gain per-block item buffers that are concatenated in order
+  // once every block is done.
   for (size_t i = 0; i < blocks->size(); i++) {
     PSBBlock &block = blocks->at(i);
 
@@ -7,7 +7,6 @@
 //===----------------------------------------------------------------------===//
 
 #include <map>
-#include <set>
 
 #include "lldb/Core/DataFileCache.h"
 #include "lldb/Core/Module.h"
@@ -25,6 +24,7 @@
 #include "lldb/Utility/Timer.h"
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DJB.h"
 
@@ -305,7 +305,7 @@ void Symtab::InitNameIndexes() {
 
     // The "const char *" in "class_contexts" and backlog::value_type::second
     // must come from a ConstString::GetCString()
-    std::set<const char *> class_contexts;
+    llvm::DenseSet<const char *> class_contexts;
     std::vector<std::pair<NameToIndexMap::Entry, const char *>> backlog;
     backlog.reserve(num_symbols / 2);
 
@@ -393,7 +393,7 @@ void Symtab::InitNameIndexes() {
 }
 
 void Symtab::RegisterMangledNameEntry(
-    uint32_t value, std::set<const char *> &class_contexts,
+    uint32_t value, llvm::DenseSet<const char *> &class_contexts,
     std::vector<std::pair<NameToIndexMap::Entry, const char *>> &backlog,
     RichManglingContext &rmc) {
   // Only register functions that have a base name.
@@ -418,10 +418,8 @@ void Symtab::RegisterMangledNameEntry(
     return;
   }
 
-  // Make sure we have a pool-string pointer and see if we already know the
-  // context name.
+  // Make sure we have a pool-string pointer for the context name.
   const char *decl_context_ccstr = ConstString(decl_context).GetCString();
-  auto it = class_contexts.find(decl_context_ccstr);
 
   auto &method_to_index =
       GetNameToSymbolIndexMap(lldb::eFunctionNameTypeMethod);
@@ -429,13 +427,12 @@ void Symtab::RegisterMangledNameEntry(
   // declaration contexts.
   if (rmc.IsCtorOrDtor()) {
     method_to_index.Append(entry);
-    if (it == class_contexts.end())
-      class_contexts.insert(it, decl_context_ccstr);
+    class_contexts.insert(decl_context_ccstr);
     return;
   }
 
   // Register regular methods with a known declaration context.
-  if (it != class_contexts.end()) {
+  if (class_contexts.contains(decl_context_ccstr)) {
     method_to_index.Append(entry);
     return;
   }
@@ -447,7 +444,7 @@ void Symtab::RegisterMangledNameEntry(
 
 void Symtab::RegisterBacklogEntry(
     const NameToIndexMap::Entry &entry, const char *decl_context,
-    const std::set<const char *> &class_contexts) {
+    const llvm::DenseSet<const char *> &class_contexts) {
   auto &method_to_index =
       GetNameToSymbolIndexMap(lldb::eFunctionNameTypeMethod);
   auto it = class_contexts.find(decl_context);
@@ -10,6 +10,8 @@
 #include "EventHelper.h"
 #include "JSONUtils.h"
 #include "RequestHandler.h"
+#include <algorithm>
+#include <cstdint>
 
 namespace lldb_dap {
 
@@ -218,7 +220,18 @@ void VariablesRequestHandler::operator()(
             dap.configuration.enableSyntheticChildDebugging,
             /*is_name_duplicated=*/false, custom_name));
       };
-      const int64_t num_children = variable.GetNumChildren();
+      // For a paged request, don't make synthetic providers count children
+      // past the page. One extra child is enough to tell whether this page
+      // reaches the end of the container. start and count come from the
+      // client, so clamp them before they are added and narrowed to the
+      // uint32_t bound.
+      const int64_t num_children =
+          count == 0
+              ? variable.GetNumChildren()
+              : variable.GetNumChildren(std::min<int64_t>(
+                    std::min<int64_t>(start, UINT32_MAX) +
+                        std::min<int64_t>(count, UINT32_MAX) + 1,
+                    UINT32_MAX));
       int64_t end_idx = start + ((count == 0) ? num_children : count);
       int64_t i = start;
       for (; i < end_idx && i < num_children; ++i)
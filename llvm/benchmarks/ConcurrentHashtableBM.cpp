@@ -0,0 +1,123 @@
+//===- ConcurrentHashtableBM.cpp - Concurrent string interning benchmark --===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// These benchmarks intern the same set of strings from llvm::parallel worker
+// threads into ConcurrentHashTableByPtr and into the mutex-protected StringMap
+// schemes that linkers and DWARF tools hand-roll today: a single map behind
+// one lock, and a map sharded by hash with one lock per shard. Half of the
+// insertions are duplicates, as is typical for symbol and type names.
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/ConcurrentHashtable.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Parallel.h"
+#include "llvm/Support/PerThreadBumpPtrAllocator.h"
+#include "llvm/Support/xxhash.h"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+namespace {
+/// Every distinct key is inserted this many times.
+constexpr unsigned DuplicationFactor = 2;
+constexpr unsigned NumShards = 64;
+
+std::vector<std::string> buildKeys(unsigned NumKeys) {
+  std::vector<std::string> Keys;
+  Keys.reserve(NumKeys * DuplicationFactor);
+  for (unsigned Dup = 0; Dup != DuplicationFactor; ++Dup)
+    for (unsigned I = 0; I != NumKeys; ++I)
+      Keys.push_back("_ZN4llvm6detail6symbolE" + std::to_string(I));
+  return Keys;
+}
+
+class StringEntry {
+public:
+  const std::string &getKey() const { return Key; }
+
+  template <typename AllocatorTy>
+  static StringEntry *create(const std::string &Key, AllocatorTy &Allocator) {
+    StringEntry *Result = Allocator.template Allocate<StringEntry>();
+    new (Result) StringEntry(Key);
+    return Result;
+  }
+
+private:
+  StringEntry(const std::string &Key) : Key(Key) {}
+
+  std::string Key;
+};
+
+using StringTable = ConcurrentHashTableByPtr<
+    std::string, StringEntry, parallel::PerThreadBumpPtrAllocator,
+    ConcurrentHashTableInfoByPtr<std::string, StringEntry,
+                                 parallel::PerThreadBumpPtrAllocator>>;
+
+struct ShardedStringMap {
+  struct Shard {
+    std::mutex Mutex;
+    StringMap<std::nullopt_t> Map;
+  };
+  std::array<Shard, NumShards> Shards;
+
+  bool insert(StringRef Key) {
+    Shard &S = Shards[xxh3_64bits(Key) % NumShards];
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    return S.Map.try_emplace(Key, std::nullopt).second;
+  }
+};
+} // namespace
+
+static void BM_ConcurrentHashTable(benchmark::State &State) {
+  std::vector<std::string> Keys = buildKeys(State.range(0));
+  for (auto _ : State) {
+    parallel::PerThreadBumpPtrAllocator Allocator;
+    StringTable Table(Allocator, State.range(0));
+    parallelFor(0, Keys.size(), [&](size_t I) {
+      benchmark::DoNotOptimize(Table.insert(Keys[I]));
+    });
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+
+static void BM_LockedStringMap(benchmark::State &State) {
+  std::vector<std::string> Keys = buildKeys(State.range(0));
+  for (auto _ : State) {
+    std::mutex Mutex;
+    StringMap<std::nullopt_t> Map;
+    parallelFor(0, Keys.size(), [&](size_t I) {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      benchmark::DoNotOptimize(Map.try_emplace(Keys[I], std::nullopt));
+    });
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+
+static void BM_ShardedStringMap(benchmark::State &State) {
+  std::vector<std::string> Keys = buildKeys(State.range(0));
+  for (auto _ : State) {
+    auto Map = std::make_unique<ShardedStringMap>();
+    parallelFor(0, Keys.size(), [&](size_t I) {
+      benchmark::DoNotOptimize(Map->insert(Keys[I]));
+    });
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+
+BENCHMARK(BM_ConcurrentHashTable)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK(BM_LockedStringMap)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK(BM_ShardedStringMap)->Range(1 << 10, 1 << 20)->UseRealTime();
+
+BENCHMARK_MAIN();
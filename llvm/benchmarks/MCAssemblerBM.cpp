@@ -0,0 +1,196 @@
+//===- MCAssemblerBM.cpp - Integrated assembler throughput benchmark ------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// These benchmarks assemble a synthetic corpus for x86-64, AArch64 and RISC-V
+// through the same MC objects that llvm-mc uses. BM_Parse sends the parsed
+// instructions to a null streamer, so it measures lexing, parsing and operand
+// matching; BM_Assemble additionally encodes, relaxes and writes an ELF object
+// into memory. The difference between the two is the encoding and layout
+// cost. Targets that are not built are skipped.
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/MC/MCAsmBackend.h"
+#include "llvm/MC/MCAsmInfo.h"
+#include "llvm/MC/MCCodeEmitter.h"
+#include "llvm/MC/MCContext.h"
+#include "llvm/MC/MCInstrInfo.h"
+#include "llvm/MC/MCObjectFileInfo.h"
+#include "llvm/MC/MCObjectWriter.h"
+#include "llvm/MC/MCParser/MCAsmParser.h"
+#include "llvm/MC/MCParser/MCTargetAsmParser.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/MC/MCStreamer.h"
+#include "llvm/MC/MCSubtargetInfo.h"
+#include "llvm/MC/MCTargetOptions.h"
+#include "llvm/MC/TargetRegistry.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/TargetParser/Triple.h"
+#include <memory>
+#include <string>
+
+using namespace llvm;
+
+namespace {
+/// Number of times the per-target block is repeated in the corpus.
+constexpr unsigned NumBlocks = 4096;
+/// Number of instructions in each block below.
+constexpr unsigned InstsPerBlock = 4;
+
+/// Build a corpus of NumBlocks blocks. Every block ends with a forward
+/// conditional branch to its own local label so the backend has fixups to
+/// resolve.
+std::string buildCorpus(const Triple &TT) {
+  std::string Corpus;
+  raw_string_ostream OS(Corpus);
+  for (unsigned I = 0; I != NumBlocks; ++I) {
+    switch (TT.getArch()) {
+    case Triple::x86_64:
+      OS << "\taddq %rax, %rbx\n"
+         << "\tmovq 8(%rsp), %rcx\n"
+         << "\tleaq 16(%rcx,%rdx,4), %rsi\n"
+         << "\tjne .Ltmp" << I << "\n";
+      break;
+    case Triple::aarch64:
+      OS << "\tadd x0, x1, x2\n"
+         << "\tldr x3, [sp, #8]\n"
+         << "\tmadd x4, x5, x6, x7\n"
+         << "\tb.ne .Ltmp" << I << "\n";
+      break;
+    case Triple::riscv64:
+      OS << "\tadd a0, a1, a2\n"
+         << "\tld a3, 8(sp)\n"
+         << "\taddi a4, a5, 16\n"
+         << "\tbne a0, a1, .Ltmp" << I << "\n";
+      break;
+    default:
+      llvm_unreachable("no corpus for this target");
+    }
+    OS << ".Ltmp" << I << ":\n";
+  }
+  return Corpus;
+}
+
+/// The target-level MC objects, which are reused by every iteration.
+struct MCTargetFixture {
+  Triple TT;
+  const Target *TheTarget = nullptr;
+  MCTargetOptions MCOptions;
+  std::unique_ptr<MCRegisterInfo> MRI;
+  std::unique_ptr<MCAsmInfo> MAI;
+  std::unique_ptr<MCSubtargetInfo> STI;
+  std::unique_ptr<MCInstrInfo> MCII;
+  std::string Corpus;
+
+  explicit MCTargetFixture(StringRef TripleName) : TT(TripleName) {
+    InitializeAllTargetInfos();
+    InitializeAllTargetMCs();
+    InitializeAllAsmParsers();
+
+    std::string Error;
+    TheTarget = TargetRegistry::lookupTarget(TT, Error);
+    if (!TheTarget || !TheTarget->hasMCAsmParser())
+      return;
+    MRI.reset(TheTarget->createMCRegInfo(TT.str()));
+    MAI.reset(TheTarget->createMCAsmInfo(*MRI, TT.str(), MCOptions));
+    STI.reset(TheTarget->createMCSubtargetInfo(TT.str(), "", ""));
+    MCII.reset(TheTarget->createMCInstrInfo());
+    Corpus = buildCorpus(TT);
+  }
+
+  bool isAvailable() const { return MCII != nullptr; }
+
+  /// Assemble the corpus once. If \p OS is null the output goes to a null
+  /// streamer, otherwise an ELF object is written to it.
+  bool assemble(raw_pwrite_stream *OS) const {
+    SourceMgr SrcMgr;
+    SrcMgr.AddNewSourceBuffer(
+        MemoryBuffer::getMemBuffer(Corpus, "<corpus>",
+                                   /*RequiresNullTerminator=*/false),
+        SMLoc());
+    MCContext Ctx(TT, MAI.get(), MRI.get(), STI.get(), &SrcMgr, &MCOptions);
+    std::unique_ptr<MCObjectFileInfo> MOFI(
+        TheTarget->createMCObjectFileInfo(Ctx, /*PIC=*/false));
+    Ctx.setObjectFileInfo(MOFI.get());
+
+    std::unique_ptr<MCStreamer> Str;
+    if (OS) {
+      MCCodeEmitter *CE = TheTarget->createMCCodeEmitter(*MCII, Ctx);
+      MCAsmBackend *MAB = TheTarget->createMCAsmBackend(*STI, *MRI, MCOptions);
+      Str.reset(TheTarget->createMCObjectStreamer(
+          TT, Ctx, std::unique_ptr<MCAsmBackend>(MAB),
+          MAB->createObjectWriter(*OS), std::unique_ptr<MCCodeEmitter>(CE),
+          *STI));
+    } else {
+      Str.reset(TheTarget->createNullStreamer(Ctx));
+    }
+
+    std::unique_ptr<MCAsmParser> Parser(
+        createMCAsmParser(SrcMgr, Ctx, *Str, *MAI));
+    std::unique_ptr<MCTargetAsmParser> TAP(
+        TheTarget->createMCAsmParser(*STI, *Parser, *MCII, MCOptions));
+    Parser->setTargetParser(*TAP);
+    return !Parser->Run(/*NoInitialTextSection=*/false);
+  }
+};
+} // namespace
+
+static void reportThroughput(benchmark::State &State,
+                             const MCTargetFixture &Fixture) {
+  State.SetBytesProcessed(State.iterations() * Fixture.Corpus.size());
+  State.counters["insts/s"] =
+      benchmark::Counter(State.iterations() * NumBlocks * InstsPerBlock,
+                         benchmark::Counter::kIsRate);
+}
+
+static void BM_Parse(benchmark::State &State, const char *TripleName) {
+  MCTargetFixture Fixture(TripleName);
+  if (!Fixture.isAvailable()) {
+    State.SkipWithMessage("target not built");
+    return;
+  }
+  for (auto _ : State)
+    if (!Fixture.assemble(/*OS=*/nullptr)) {
+      State.SkipWithError("failed to assemble the corpus");
+      return;
+    }
+  reportThroughput(State, Fixture);
+}
+
+static void BM_Assemble(benchmark::State &State, const char *TripleName) {
+  MCTargetFixture Fixture(TripleName);
+  if (!Fixture.isAvailable()) {
+    State.SkipWithMessage("target not built");
+    return;
+  }
+  SmallString<0> Object;
+  for (auto _ : State) {
+    Object.clear();
+    raw_svector_ostream OS(Object);
+    if (!Fixture.assemble(&OS)) {
+      State.SkipWithError("failed to assemble the corpus");
+      return;
+    }
+    benchmark::DoNotOptimize(Object.data());
+  }
+  reportThroughput(State, Fixture);
+}
+
+BENCHMARK_CAPTURE(BM_Parse, x86_64, "x86_64-unknown-linux-gnu");
+BENCHMARK_CAPTURE(BM_Parse, aarch64, "aarch64-unknown-linux-gnu");
+BENCHMARK_CAPTURE(BM_Parse, riscv64, "riscv64-unknown-linux-gnu");
+BENCHMARK_CAPTURE(BM_Assemble, x86_64, "x86_64-unknown-linux-gnu");
+BENCHMARK_CAPTURE(BM_Assemble, aarch64, "aarch64-unknown-linux-gnu");
+BENCHMARK_CAPTURE(BM_Assemble, riscv64, "riscv64-unknown-linux-gnu");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+//===- NativeFormattingBM.cpp - Integer formatting benchmark --------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// These benchmarks measure raw_ostream's integer and hex formatting, which
+// dominates the output of the asm printer, the IR printer and llvm-objdump.
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/raw_ostream.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace llvm;
+
+/// Values whose decimal length is uniformly distributed between one digit and
+/// MaxDigits digits.
+static std::vector<uint64_t> buildValues(unsigned MaxDigits) {
+  std::mt19937_64 Rng(0);
+  std::vector<uint64_t> Values(4096);
+  for (uint64_t &V : Values) {
+    uint64_t Limit = 1;
+    for (unsigned D = Rng() % MaxDigits + 1; D; --D)
+      Limit = Limit > UINT64_MAX / 10 ? UINT64_MAX : Limit * 10;
+    V = Rng() % Limit;
+  }
+  return Values;
+}
+
+static void BM_WriteUnsigned(benchmark::State &State) {
+  std::vector<uint64_t> Values = buildValues(State.range(0));
+  SmallString<0> Out;
+  for (auto _ : State) {
+    Out.clear();
+    raw_svector_ostream OS(Out);
+    for (uint64_t V : Values)
+      OS << V << ' ';
+    benchmark::DoNotOptimize(Out.data());
+  }
+  State.SetItemsProcessed(State.iterations() * Values.size());
+}
+
+static void BM_WriteSigned(benchmark::State &State) {
+  std::vector<uint64_t> Values = buildValues(State.range(0));
+  SmallString<0> Out;
+  for (auto _ : State) {
+    Out.clear();
+    raw_svector_ostream OS(Out);
+    for (uint64_t V : Values)
+      OS << -static_cast<int64_t>(V >> 1) << ' ';
+    benchmark::DoNotOptimize(Out.data());
+  }
+  State.SetItemsProcessed(State.iterations() * Values.size());
+}
+
+static void BM_FormatHex(benchmark::State &State) {
+  std::vector<uint64_t> Values = buildValues(State.range(0));
+  SmallString<0> Out;
+  for (auto _ : State) {
+    Out.clear();
+    raw_svector_ostream OS(Out);
+    for (uint64_t V : Values)
+      OS << format_hex(V, 18) << ' ';
+    benchmark::DoNotOptimize(Out.data());
+  }
+  State.SetItemsProcessed(State.iterations() * Values.size());
+}
+
+BENCHMARK(BM_WriteUnsigned)->Arg(2)->Arg(10)->Arg(20);
+BENCHMARK(BM_WriteSigned)->Arg(2)->Arg(10)->Arg(20);
+BENCHMARK(BM_FormatHex)->Arg(2)->Arg(10)->Arg(20);
+
+BENCHMARK_MAIN();
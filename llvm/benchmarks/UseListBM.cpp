@@ -0,0 +1,94 @@
+//===- UseListBM.cpp - Use-list traversal and update benchmark ------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// These benchmarks measure the cost of walking and rewriting the use-list of a
+// single Value with many uses, which is what replaceAllUsesWith() and users()
+// iteration do in InstCombine and GVN.
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include <memory>
+
+using namespace llvm;
+
+namespace {
+/// A function `void @f(i32 %a, i32 %b)` whose first argument has NumUses
+/// users, all of them `add` instructions in the entry block.
+struct UseListFixture {
+  LLVMContext Ctx;
+  std::unique_ptr<Module> M;
+  Function *F = nullptr;
+  Argument *A = nullptr;
+  Argument *B = nullptr;
+
+  explicit UseListFixture(unsigned NumUses)
+      : M(std::make_unique<Module>("UseListBM", Ctx)) {
+    Type *I32 = Type::getInt32Ty(Ctx);
+    auto *FTy =
+        FunctionType::get(Type::getVoidTy(Ctx), {I32, I32}, /*isVarArg=*/false);
+    F = Function::Create(FTy, Function::ExternalLinkage, "f", *M);
+    A = F->getArg(0);
+    B = F->getArg(1);
+    IRBuilder<> Builder(BasicBlock::Create(Ctx, "entry", F));
+    for (unsigned I = 0; I != NumUses; ++I)
+      Builder.CreateAdd(A, Builder.getInt32(I));
+    Builder.CreateRetVoid();
+  }
+};
+} // namespace
+
+static void BM_UsersIteration(benchmark::State &State) {
+  UseListFixture Fixture(State.range(0));
+  for (auto _ : State) {
+    unsigned NumOperands = 0;
+    for (User *U : Fixture.A->users())
+      NumOperands += U->getNumOperands();
+    benchmark::DoNotOptimize(NumOperands);
+  }
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void BM_ReplaceAllUsesWith(benchmark::State &State) {
+  UseListFixture Fixture(State.range(0));
+  for (auto _ : State) {
+    // Bounce the uses between the two arguments so every iteration rewrites
+    // the same number of uses.
+    Fixture.A->replaceAllUsesWith(Fixture.B);
+    Fixture.B->replaceAllUsesWith(Fixture.A);
+  }
+  State.SetItemsProcessed(State.iterations() * State.range(0) * 2);
+}
+
+static void BM_UseListBuildAndErase(benchmark::State &State) {
+  UseListFixture Fixture(/*NumUses=*/0);
+  BasicBlock &Entry = Fixture.F->getEntryBlock();
+  Value *Other = Fixture.B;
+  for (auto _ : State) {
+    IRBuilder<> Builder(Entry.getTerminator());
+    SmallVector<Instruction *> Users;
+    for (int64_t I = 0, E = State.range(0); I != E; ++I)
+      Users.push_back(cast<Instruction>(Builder.CreateAdd(Fixture.A, Other)));
+    // Erase in reverse order so every instruction is unused when it goes.
+    while (!Users.empty())
+      Users.pop_back_val()->eraseFromParent();
+  }
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+BENCHMARK(BM_UsersIteration)->RangeMultiplier(8)->Range(8, 1 << 18);
+BENCHMARK(BM_ReplaceAllUsesWith)->RangeMultiplier(8)->Range(8, 1 << 18);
+BENCHMARK(BM_UseListBuildAndErase)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+BENCHMARK_MAIN();
@@ -85,6 +85,12 @@ public:
   LLVM_ABI Expected<DILineInfo>
   symbolizeCode(ArrayRef<uint8_t> BuildID,
                 object::SectionedAddress ModuleOffset);
+  /// Symbolize each of \p ModuleOffsets in the module \p ModuleName. This is
+  /// equivalent to calling symbolizeCode() for each offset, but the module is
+  /// looked up only once.
+  LLVM_ABI Expected<std::vector<DILineInfo>>
+  symbolizeCodeBatch(StringRef ModuleName,
+                     ArrayRef<object::SectionedAddress> ModuleOffsets);
   LLVM_ABI Expected<DIInliningInfo>
   symbolizeInlinedCode(const ObjectFile &Obj,
                        object::SectionedAddress ModuleOffset);
@@ -143,6 +149,9 @@ private:
   // corresponding debug info. These objects can be the same.
   using ObjectPair = std::pair<const ObjectFile *, const ObjectFile *>;
 
+  DILineInfo symbolizeCodeInModule(SymbolizableModule *Info,
+                                   object::SectionedAddress ModuleOffset,
+                                   const DILineInfoSpecifier &Spec);
   template <typename T>
   Expected<DILineInfo>
   symbolizeCodeCommon(const T &ModuleSpecifier,
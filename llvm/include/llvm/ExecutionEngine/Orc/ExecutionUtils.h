@@ -340,13 +340,16 @@ private:
       ObjectLayer &L, std::unique_ptr<MemoryBuffer> ArchiveBuffer,
       std::unique_ptr<object::Archive> Archive,
       GetObjectFileInterface GetObjFileInterface,
-      DenseMap<SymbolStringPtr, size_t> SymbolToMemberIndexMap);
+      DenseMap<SymbolStringPtr, size_t> SymbolToMemberIndexMap,
+      std::vector<object::Archive::Child> Members);
 
   ObjectLayer &L;
   GetObjectFileInterface GetObjFileInterface;
   std::unique_ptr<MemoryBuffer> ArchiveBuffer;
   std::unique_ptr<object::Archive> Archive;
   DenseMap<SymbolStringPtr, size_t> SymbolToMemberIndexMap;
+  /// Archive members in archive order, indexed by SymbolToMemberIndexMap.
+  std::vector<object::Archive::Child> Members;
 };
 
 /// A utility class to create COFF dllimport GOT symbols (__imp_*) and PLT
@@ -0,0 +1,77 @@
+//===-- OnDiskObjectCache.h - Content-addressed JIT object cache -*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// An ObjectCache that stores compiled objects in a directory, keyed by a hash
+// of the module's bitcode and the target configuration.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_EXECUTIONENGINE_ORC_ONDISKOBJECTCACHE_H
+#define LLVM_EXECUTIONENGINE_ORC_ONDISKOBJECTCACHE_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/Support/CachePruning.h"
+#include "llvm/Support/Compiler.h"
+#include "llvm/Support/Error.h"
+#include <mutex>
+#include <string>
+
+namespace llvm {
+
+class TargetMachine;
+
+namespace orc {
+
+/// An ObjectCache that persists objects across processes.
+///
+/// Each object is stored in CacheDir under a name derived from the SHA1 of the
+/// module's bitcode together with the target triple, CPU, features,
+/// optimization level, relocation and code models, and the TargetOptions and
+/// MCTargetOptions fields that affect the emitted object, so a cached object
+/// is only reused for an identical module compiled with an equivalent
+/// TargetMachine configuration. Other TargetOptions (e.g. the floating-point
+/// flags, which are normally carried by function attributes) are not part of
+/// the key. Files are named "llvmcache-*" so that the directory can be pruned
+/// with pruneCache().
+///
+/// Use with SimpleCompiler or ConcurrentIRCompiler (e.g. via
+/// LLJITBuilder::setCompileFunctionCreator). This class is thread-safe.
+class LLVM_ABI OnDiskObjectCache : public ObjectCache {
+public:
+  /// Create a cache rooted at CacheDir for objects compiled by TM. The
+  /// directory is created if it does not exist.
+  static Expected<std::unique_ptr<OnDiskObjectCache>>
+  Create(StringRef CacheDir, const TargetMachine &TM);
+
+  void notifyObjectCompiled(const Module *M, MemoryBufferRef Obj) override;
+  std::unique_ptr<MemoryBuffer> getObject(const Module *M) override;
+
+  /// Prune the cache directory according to Policy. Returns false if the
+  /// directory could not be pruned.
+  bool prune(const CachePruningPolicy &Policy);
+
+private:
+  OnDiskObjectCache(std::string CacheDir, std::string TargetKey)
+      : CacheDir(std::move(CacheDir)), TargetKey(std::move(TargetKey)) {}
+
+  std::string getCacheFilePath(const Module &M) const;
+
+  std::string CacheDir;
+  std::string TargetKey;
+
+  // Codegen may modify the module, so the path computed on a cache miss is
+  // remembered until the corresponding notifyObjectCompiled call.
+  std::mutex PendingMutex;
+  DenseMap<const Module *, std::string> PendingPaths;
+};
+
+} // end namespace orc
+} // end namespace llvm
+
+#endif // LLVM_EXECUTIONENGINE_ORC_ONDISKOBJECTCACHE_H
@@ -79,6 +79,10 @@ public:
                                         unsigned CurVersion,
                                         ThreadSafeModule &TSM);
 
+  /// Returns an AddProfilerFunc that behaves like reoptimizeIfCallFrequent but
+  /// requests reoptimization once the call count exceeds \p Threshold.
+  static AddProfilerFunc reoptimizeIfCallCountExceeds(uint64_t Threshold);
+
   static Error identity(ReOptimizeLayer &Parent,
                         ReOptMaterializationUnitID MUID, unsigned CurVersion,
                         ResourceTrackerSP OldRT, ThreadSafeModule &TSM) {
@@ -148,6 +152,10 @@ private:
   void rt_reoptimize(SendErrorFn SendResult, ReOptMaterializationUnitID MUID,
                      uint32_t CurVersion);
 
+  static Error addCallCountProfiler(ReOptMaterializationUnitID MUID,
+                                    unsigned CurVersion, ThreadSafeModule &TSM,
+                                    uint64_t Threshold);
+
   static Expected<Constant *>
   createReoptimizeArgBuffer(Module &M, ReOptMaterializationUnitID MUID,
                             uint32_t CurVersion);
@@ -32,6 +32,12 @@ public:
 };
 
 // Direct calls in high frequency basic blocks are extracted.
+//
+// Block frequencies come from BlockFrequencyInfo, so if the module carries
+// branch-weight or entry-count metadata (e.g. from a previous run's profile)
+// the speculation follows the profile rather than static heuristics. Queries
+// are plain callables passed to IRSpeculationLayer, so a client can also
+// supply one that reads a recorded call-sequence profile directly.
 class BlockFreqQuery : public SpeculateQuery {
   size_t numBBToGet(size_t);
 
@@ -886,6 +886,10 @@ private:
   /// List of <CalleeValueInfo, CalleeInfo> call edge pairs from this function.
   /// We use SmallVector<ValueInfo, 0> instead of std::vector<ValueInfo> for its
   /// smaller memory footprint.
+  /// FIXME: Each summary still owns a separate heap allocation for its edges.
+  /// In a combined index with millions of functions, a shared columnar edge
+  /// store that summaries index into would be much smaller, but calls()
+  /// returning an ArrayRef of pairs is relied on throughout the IPO analyses.
   SmallVector<EdgeTy, 0> CallGraphEdgeList;
 
   std::unique_ptr<TypeIdInfo> TIdInfo;
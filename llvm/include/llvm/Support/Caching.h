@@ -82,6 +82,13 @@ using FileCacheFunction = std::function<Expected<AddStreamFn>(
 ///   ProduceContent(AddStream);
 ///
 /// CacheDirectoryPath stores the directory path where cached files are kept.
+///
+/// A FileCache is just a callable, so additional tiers (for example a shared
+/// remote store in front of localCache()) can be layered by wrapping another
+/// FileCache's function: look the key up remotely, add the buffer on a hit,
+/// and otherwise forward to the wrapped cache. Keys computed by
+/// lto::computeLTOCacheKey are content hashes and are safe to share between
+/// machines that run the same compiler.
 struct FileCache {
   FileCache(FileCacheFunction CacheFn, const std::string &DirectoryPath)
       : CacheFunction(std::move(CacheFn)), CacheDirectoryPath(DirectoryPath) {}
@@ -63,9 +63,13 @@ constexpr int BestSizeCompression = 12;
 
 LLVM_ABI bool isAvailable();
 
+/// Compress Input. If NumWorkers is non-zero and libzstd was built with
+/// multi-threading support, compression is split across that many zstd worker
+/// threads; otherwise it runs on the calling thread.
 LLVM_ABI void compress(ArrayRef<uint8_t> Input,
                        SmallVectorImpl<uint8_t> &CompressedBuffer,
-                       int Level = DefaultCompression, bool EnableLdm = false);
+                       int Level = DefaultCompression, bool EnableLdm = false,
+                       unsigned NumWorkers = 0);
 
 LLVM_ABI Error decompress(ArrayRef<uint8_t> Input, uint8_t *Output,
                           size_t &UncompressedSize);
@@ -104,9 +108,10 @@ struct Params {
   Format format;
   int level;
   bool zstdEnableLdm = false; // Enable zstd long distance matching
-  // This may support multi-threading for zstd in the future. Note that
-  // different threads may produce different output, so be careful if certain
-  // output determinism is desired.
+  // Number of zstd worker threads, or 0 to compress on the calling thread.
+  // Output with workers differs from single-threaded output, so keep this
+  // fixed if output determinism across configurations is desired.
+  unsigned zstdNumWorkers = 0;
 };
 
 // Return nullptr if LLVM was built with support (LLVM_ENABLE_ZLIB,
@@ -430,6 +430,10 @@ public:
   /// methods should return the value returned by this function.
   virtual Instruction *eraseInstFromFunction(Instruction &I) = 0;
 
+  // FIXME: Results are recomputed on every call. They depend on the context
+  // instruction (assumptions and dominating conditions) as well as on V, so a
+  // cache would have to be keyed on both and invalidated whenever the worklist
+  // changes an instruction anywhere in V's operand tree.
   void computeKnownBits(const Value *V, KnownBits &Known,
                         const Instruction *CxtI, unsigned Depth = 0) const {
     llvm::computeKnownBits(V, Known, SQ.getWithInstruction(CxtI), Depth);
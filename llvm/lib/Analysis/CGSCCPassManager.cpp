@@ -195,6 +195,11 @@ ModuleToPostOrderCGSCCPassAdaptor::run(Module &M, ModuleAnalysisManager &AM) {
     //
     // We also eagerly increment the iterator to the next position because
     // the CGSCC passes below may delete the current RefSCC.
+    //
+    // FIXME: RefSCCs are visited one at a time. Running independent ones on
+    // different threads is not possible while passes mutate the shared
+    // LazyCallGraph (and the LLVMContext) and may merge or split RefSCCs that
+    // a concurrent walk would already have scheduled.
     RCWorklist.insert(&RC);
 
     do {
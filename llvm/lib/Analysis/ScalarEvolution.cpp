@@ -14676,6 +14676,10 @@ bool ScalarEvolution::invalidate(
     FunctionAnalysisManager::Invalidator &Inv) {
   // Invalidate the ScalarEvolution object whenever it isn't preserved or one
   // of its dependencies is invalidated.
+  // FIXME: This drops every cached expression. Loop passes already keep SCEV
+  // up to date through forgetValue/forgetLoop, but function passes between
+  // loop pipelines have no way to report which values they changed, so
+  // invalidation here cannot be narrowed to the affected expressions.
   auto PAC = PA.getChecker<ScalarEvolutionAnalysis>();
   return !(PAC.preserved() || PAC.preservedSet<AllAnalysesOn<Function>>()) ||
          Inv.invalidate<AssumptionAnalysis>(F, PA) ||
@@ -60,6 +60,11 @@ void DwarfFile::computeSizeAndOffsets() {
 
   // Iterate over each compile unit and set the size and offsets for each
   // DIE within each compile unit. All offsets are CU relative.
+  // FIXME: Units are laid out one after another even though their offsets are
+  // CU relative, because every unit uniques its abbreviations into the one
+  // shared Abbrevs set and the abbreviation numbers feed back into the sizes.
+  // Per-unit layout in parallel would first need per-unit abbreviation sets
+  // that are merged deterministically before emission.
   for (const auto &TheU : CUs) {
     if (TheU->getCUNode()->isDebugDirectivesOnly())
       continue;
@@ -32,6 +32,8 @@ STATISTIC(NumOneIteration, "Number of functions with one iteration");
 STATISTIC(NumTwoIterations, "Number of functions with two iterations");
 STATISTIC(NumThreeOrMoreIterations,
           "Number of functions with three or more iterations");
+STATISTIC(NumCombineAttempts, "Number of instructions the combiner tried");
+STATISTIC(NumCombinesApplied, "Number of instructions combined");
 
 namespace llvm {
 cl::OptionCategory GICombinerOptionCategory(
@@ -311,11 +313,14 @@ bool Combiner::combineMachineInstrs() {
     while (!WorkList.empty()) {
       MachineInstr &CurrInst = *WorkList.pop_back_val();
       LLVM_DEBUG(dbgs() << "\nTry combining " << CurrInst);
+      ++NumCombineAttempts;
       bool AppliedCombine = tryCombineAll(CurrInst);
       LLVM_DEBUG(WLObserver->reportFullyCreatedInstrs());
       Changed |= AppliedCombine;
-      if (AppliedCombine)
+      if (AppliedCombine) {
+        ++NumCombinesApplied;
         WLObserver->appliedCombine();
+      }
     }
     MFChanged |= Changed;
 
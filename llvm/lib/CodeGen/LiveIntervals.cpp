@@ -235,6 +235,12 @@ bool LiveIntervals::computeVirtRegInterval(LiveInterval &LI) {
 }
 
 void LiveIntervals::computeVirtRegs() {
+  // FIXME: Each interval is computed by its own walk over the register's
+  // def/use list, with segments in a per-interval SmallVector and VNInfos in
+  // the shared bump allocator. A single bulk pass over the function that
+  // fills contiguous per-function segment arrays would be more cache
+  // friendly, but LiveRange's mutable Segment vector is the interface that
+  // SplitKit, the coalescer and the allocators all edit in place.
   for (unsigned i = 0, e = MRI->getNumVirtRegs(); i != e; ++i) {
     Register Reg = Register::index2VirtReg(i);
     if (MRI->reg_nodbg_empty(Reg))
@@ -745,6 +745,11 @@ void MachineOutliner::findCandidates(
     InstructionMapper &Mapper,
     std::vector<std::unique_ptr<OutlinedFunction>> &FunctionList) {
   FunctionList.clear();
+  // FIXME: The tree is built over the whole module's mapping at once, so its
+  // memory is linear in the number of mapped instructions with a large
+  // constant. Sharding the mapping (e.g. per section) would bound that, but
+  // would also miss repeats that span shards, so it needs to be measured
+  // against the outlined size before it can be the default.
   SuffixTree ST(Mapper.UnsignedVec, OutlinerLeafDescendants);
 
   // First, find all of the repeated substrings in the tree of minimum length
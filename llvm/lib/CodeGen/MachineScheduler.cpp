@@ -902,6 +902,11 @@ void MachineSchedulerBase::scheduleRegions(ScheduleDAGInstrs &Scheduler,
 
       // Schedule a region: possibly reorder instructions.
       // This invalidates the original region iterators.
+      // FIXME: Regions are scheduled one at a time because schedule() updates
+      // LiveIntervals and the region's pressure trackers in place, so two
+      // regions cannot be scheduled concurrently. For the same reason the
+      // DAG is rebuilt whenever a multi-stage strategy revisits a region; a
+      // snapshot would be stale as soon as an earlier region moved.
       Scheduler.schedule();
 
       // Close the current region.
@@ -76,12 +76,14 @@
 #include "llvm/MC/MCTargetOptions.h"
 #include "llvm/Pass.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MathExtras.h"
 #include "llvm/Support/ModRef.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 #include "llvm/Target/TargetMachine.h"
 #include <algorithm>
 #include <cassert>
@@ -93,6 +95,22 @@
 
 using namespace llvm;
 
+static cl::opt<unsigned> VerifyMachineFunctionSampleRate(
+    "verify-machineinstrs-sample-rate", cl::Hidden, cl::init(1),
+    cl::desc("Only run the machine verifier passes on about one in N "
+             "functions, chosen by a hash of the function name (1 = verify "
+             "every function)"));
+
+/// Return true if the machine verifier passes should skip \p MF because it
+/// is not in the sample selected by -verify-machineinstrs-sample-rate. The
+/// choice depends only on the function name, so it is stable across passes
+/// and runs.
+static bool isSampledOut(const MachineFunction &MF) {
+  if (VerifyMachineFunctionSampleRate <= 1)
+    return false;
+  return xxh3_64bits(MF.getName()) % VerifyMachineFunctionSampleRate != 0;
+}
+
 namespace {
 
 /// Used the by the ReportedErrors class to guarantee only one error is reported
@@ -383,7 +401,7 @@ struct MachineVerifierLegacyPass : public MachineFunctionPass {
     // Skip functions that have known verification problems.
     // FIXME: Remove this mechanism when all problematic passes have been
     // fixed.
-    if (MF.getProperties().hasFailsVerification())
+    if (MF.getProperties().hasFailsVerification() || isSampledOut(MF))
       return false;
 
     MachineVerifier(this, Banner.c_str(), &errs()).verify(MF);
@@ -399,7 +417,7 @@ MachineVerifierPass::run(MachineFunction &MF,
   // Skip functions that have known verification problems.
   // FIXME: Remove this mechanism when all problematic passes have been
   // fixed.
-  if (MF.getProperties().hasFailsVerification())
+  if (MF.getProperties().hasFailsVerification() || isSampledOut(MF))
     return PreservedAnalyses::all();
   MachineVerifier(MFAM, Banner.c_str(), &errs()).verify(MF);
   return PreservedAnalyses::all();
@@ -67,6 +67,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/Timer.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
@@ -2892,12 +2893,21 @@ bool RAGreedy::run(MachineFunction &mf) {
   GlobalCand.resize(32);  // This will grow as needed.
   SetOfBrokenHints.clear();
 
-  allocatePhysRegs();
-  tryHintsRecoloring();
+  {
+    TimeTraceScope TimeScope("RAGreedyAllocate", MF->getName());
+    allocatePhysRegs();
+  }
+  {
+    TimeTraceScope TimeScope("RAGreedyHintsRecoloring", MF->getName());
+    tryHintsRecoloring();
+  }
 
   if (VerifyEnabled)
     MF->verify(LIS, Indexes, "Before post optimization", &errs());
-  postOptimization();
+  {
+    TimeTraceScope TimeScope("RAGreedyPostOptimization", MF->getName());
+    postOptimization();
+  }
   reportStats();
 
   releaseMemory();
@@ -1445,6 +1445,10 @@ SDNode *SelectionDAG::FindNodeOrInsertPos(const FoldingSetNodeID &ID,
 }
 
 void SelectionDAG::clear() {
+  // Nodes go back to NodeAllocator's recycler and are reused by the next
+  // block. Operand storage cannot be kept the same way: shuffle masks and
+  // other side arrays are carved directly out of OperandAllocator and are
+  // never returned to OperandRecycler, so it has to be reset here.
   allnodes_clear();
   OperandRecycler.clear(OperandAllocator);
   OperandAllocator.Reset();
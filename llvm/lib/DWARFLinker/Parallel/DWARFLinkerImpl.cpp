@@ -216,6 +216,14 @@ Error DWARFLinkerImpl::link() {
   // At this stage each compile units are cloned to their own set of debug
   // sections. Now, update patches, assign offsets and assemble final file
   // glueing debug tables from each compile unit.
+  //
+  // FIXME: Input DIEs are released per unit in cleanupDataAfterClonning(), but
+  // the cloned sections of every unit stay in memory until this point. Final
+  // offsets are only known once all units, the artificial type unit and the
+  // string pools are sized, and cross-unit patches need them. Streaming units
+  // to the output early, under a memory ceiling, would need units to be laid
+  // out in a fixed order as soon as they finish, and their cross-unit
+  // references to be patched in place in the output afterwards.
   glueCompileUnitsAndWriteToTheOutput();
 
   return Error::success();
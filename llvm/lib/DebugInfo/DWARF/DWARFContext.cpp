@@ -623,6 +623,10 @@ public:
   }
 };
 
+// FIXME: Every accessor takes the same recursive mutex, so parsing two units
+// on different threads is serialized. Finer-grained locking would have to
+// start in DWARFUnit itself (DIE extraction, line tables, address ranges),
+// which extracts lazily into unsynchronized members.
 class ThreadSafeState : public ThreadUnsafeDWARFContextState {
   std::recursive_mutex Mutex;
 
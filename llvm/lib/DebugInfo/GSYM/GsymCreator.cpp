@@ -277,6 +277,10 @@ llvm::Error GsymCreator::finalize(OutputAggregator &Out) {
     if (NumBefore > 1) {
       // Sort function infos so we can emit sorted functions. Use stable sort to
       // ensure determinism.
+      // FIXME: llvm::parallelSort is not stable, so it cannot be used here
+      // without a tie-breaker on insertion order. Function infos are added
+      // from several DwarfTransformer threads, which is why that order is
+      // itself not deterministic.
       llvm::stable_sort(Funcs);
       std::vector<FunctionInfo> FinalizedFuncs;
       FinalizedFuncs.reserve(Funcs.size());
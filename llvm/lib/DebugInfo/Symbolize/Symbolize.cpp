@@ -50,6 +50,22 @@ LLVMSymbolizer::LLVMSymbolizer(const Options &Opts)
 
 LLVMSymbolizer::~LLVMSymbolizer() = default;
 
+DILineInfo
+LLVMSymbolizer::symbolizeCodeInModule(SymbolizableModule *Info,
+                                      object::SectionedAddress ModuleOffset,
+                                      const DILineInfoSpecifier &Spec) {
+  // If the user is giving us relative addresses, add the preferred base of the
+  // object to the offset before we do the query. It's what DIContext expects.
+  if (Opts.RelativeAddresses)
+    ModuleOffset.Address += Info->getModulePreferredBase();
+
+  DILineInfo LineInfo =
+      Info->symbolizeCode(ModuleOffset, Spec, Opts.UseSymbolTable);
+  if (Opts.Demangle)
+    LineInfo.FunctionName = DemangleName(LineInfo.FunctionName, Info);
+  return LineInfo;
+}
+
 template <typename T>
 Expected<DILineInfo>
 LLVMSymbolizer::symbolizeCodeCommon(const T &ModuleSpecifier,
@@ -66,19 +82,10 @@ LLVMSymbolizer::symbolizeCodeCommon(const T &ModuleSpecifier,
   if (!Info)
     return DILineInfo();
 
-  // If the user is giving us relative addresses, add the preferred base of the
-  // object to the offset before we do the query. It's what DIContext expects.
-  if (Opts.RelativeAddresses)
-    ModuleOffset.Address += Info->getModulePreferredBase();
-
-  DILineInfo LineInfo = Info->symbolizeCode(
-      ModuleOffset,
+  return symbolizeCodeInModule(
+      Info, ModuleOffset,
       DILineInfoSpecifier(Opts.PathStyle, Opts.PrintFunctions,
-                          Opts.SkipLineZero),
-      Opts.UseSymbolTable);
-  if (Opts.Demangle)
-    LineInfo.FunctionName = DemangleName(LineInfo.FunctionName, Info);
-  return LineInfo;
+                          Opts.SkipLineZero));
 }
 
 Expected<DILineInfo>
@@ -99,6 +106,28 @@ LLVMSymbolizer::symbolizeCode(ArrayRef<uint8_t> BuildID,
   return symbolizeCodeCommon(BuildID, ModuleOffset);
 }
 
+Expected<std::vector<DILineInfo>> LLVMSymbolizer::symbolizeCodeBatch(
+    StringRef ModuleName, ArrayRef<object::SectionedAddress> ModuleOffsets) {
+  auto InfoOrErr = getOrCreateModuleInfo(ModuleName);
+  if (!InfoOrErr)
+    return InfoOrErr.takeError();
+
+  SymbolizableModule *Info = *InfoOrErr;
+
+  // A null module means an error has already been reported. Return an empty
+  // result for every address.
+  if (!Info)
+    return std::vector<DILineInfo>(ModuleOffsets.size());
+
+  DILineInfoSpecifier Spec(Opts.PathStyle, Opts.PrintFunctions,
+                           Opts.SkipLineZero);
+  std::vector<DILineInfo> LineInfos;
+  LineInfos.reserve(ModuleOffsets.size());
+  for (object::SectionedAddress ModuleOffset : ModuleOffsets)
+    LineInfos.push_back(symbolizeCodeInModule(Info, ModuleOffset, Spec));
+  return LineInfos;
+}
+
 template <typename T>
 Expected<DIInliningInfo> LLVMSymbolizer::symbolizeInlinedCodeCommon(
     const T &ModuleSpecifier, object::SectionedAddress ModuleOffset) {
@@ -669,6 +698,9 @@ LLVMSymbolizer::getOrCreateModuleInfo(StringRef ModuleName) {
   // - Otherwise, if this is a COFF object containing PDB info, create a
   // PDBContext.
   // - Otherwise, create a DWARFContext.
+  // FIXME: A GSYM file shadows the binary's DWARF completely, so addresses
+  // the GSYM file does not cover get no line info even when DWARF has it.
+  // Falling back per query would need a DIContext that forwards misses.
   const auto GsymFile = lookUpGsymFile(BinaryName.str());
   if (!GsymFile.empty()) {
     auto ReaderOrErr = gsym::GsymReader::openFile(GsymFile);
@@ -129,6 +129,12 @@ private:
     return static_cast<const LinkerImpl &>(*this);
   }
 
+  // FIXME: Blocks are fixed up serially on the linking thread. Fixups for
+  // distinct blocks write disjoint memory, so large graphs could be split
+  // across the ExecutionSession's TaskDispatcher, but getMutableContent
+  // allocates from the graph's (unsynchronized) allocator and applyFixup
+  // implementations have not been audited for shared state. Independent
+  // graphs already link concurrently when a threaded dispatcher is used.
   Error fixUpBlocks(LinkGraph &G) const override {
     LLVM_DEBUG(dbgs() << "Fixing up blocks:\n");
 
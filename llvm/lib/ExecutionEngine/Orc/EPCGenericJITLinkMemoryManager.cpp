@@ -105,6 +105,10 @@ void EPCGenericJITLinkMemoryManager::allocate(const JITLinkDylib *JD,
   if (!Pages)
     return OnAllocated(Pages.takeError());
 
+  // FIXME: Each graph costs two round-trips: this reserve, and the finalize
+  // request, which already carries segment content and actions. The reserve
+  // could be avoided by sub-allocating from a pre-reserved slab, as
+  // MapperJITLinkMemoryManager does.
   EPC.callSPSWrapperAsync<rt::SPSSimpleExecutorMemoryManagerReserveSignature>(
       SAs.Reserve,
       [this, BL = std::move(BL), OnAllocated = std::move(OnAllocated)](
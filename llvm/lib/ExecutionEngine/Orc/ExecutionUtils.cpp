@@ -334,15 +334,15 @@ StaticLibraryDefinitionGenerator::Create(
   }
 
   DenseMap<SymbolStringPtr, size_t> SymbolToMemberIndexMap;
+  std::vector<object::Archive::Child> Members;
   {
     DenseMap<uint64_t, size_t> OffsetToIndex;
-    size_t Index = 0;
     Error Err = Error::success();
     for (auto &Child : Archive->children(Err)) {
       // For all members not excluded above, add them to the OffsetToIndex map.
       if (!Excluded.count(Child.getDataOffset()))
-        OffsetToIndex[Child.getDataOffset()] = Index;
-      ++Index;
+        OffsetToIndex[Child.getDataOffset()] = Members.size();
+      Members.push_back(Child);
     }
     if (Err)
       return Err;
@@ -358,14 +358,17 @@ StaticLibraryDefinitionGenerator::Create(
       if (EntryItr == OffsetToIndex.end())
         continue;
 
-      SymbolToMemberIndexMap[ES.intern(Sym.getName())] = EntryItr->second;
+      // Like Archive::findSym, the first member that defines a symbol wins.
+      SymbolToMemberIndexMap.try_emplace(ES.intern(Sym.getName()),
+                                         EntryItr->second);
     }
   }
 
   return std::unique_ptr<StaticLibraryDefinitionGenerator>(
       new StaticLibraryDefinitionGenerator(
           L, std::move(ArchiveBuffer), std::move(Archive),
-          std::move(GetObjFileInterface), std::move(SymbolToMemberIndexMap)));
+          std::move(GetObjFileInterface), std::move(SymbolToMemberIndexMap),
+          std::move(Members)));
 }
 
 Expected<std::unique_ptr<StaticLibraryDefinitionGenerator>>
@@ -439,13 +442,7 @@ Error StaticLibraryDefinitionGenerator::tryToGenerate(
     if (ToLoad.count(Index))
       continue;
 
-    auto Member = Archive->findSym(*Name);
-    if (!Member)
-      return Member.takeError();
-    if (!*Member) // Skip "none" children.
-      continue;
-
-    auto MemberBuf = (*Member)->getMemoryBufferRef();
+    auto MemberBuf = Members[Index].getMemoryBufferRef();
     if (!MemberBuf)
       return MemberBuf.takeError();
 
@@ -494,10 +491,12 @@ StaticLibraryDefinitionGenerator::StaticLibraryDefinitionGenerator(
     ObjectLayer &L, std::unique_ptr<MemoryBuffer> ArchiveBuffer,
     std::unique_ptr<object::Archive> Archive,
     GetObjectFileInterface GetObjFileInterface,
-    DenseMap<SymbolStringPtr, size_t> SymbolToMemberIndexMap)
+    DenseMap<SymbolStringPtr, size_t> SymbolToMemberIndexMap,
+    std::vector<object::Archive::Child> Members)
     : L(L), GetObjFileInterface(std::move(GetObjFileInterface)),
       ArchiveBuffer(std::move(ArchiveBuffer)), Archive(std::move(Archive)),
-      SymbolToMemberIndexMap(std::move(SymbolToMemberIndexMap)) {
+      SymbolToMemberIndexMap(std::move(SymbolToMemberIndexMap)),
+      Members(std::move(Members)) {
   if (!this->GetObjFileInterface)
     this->GetObjFileInterface = getObjectFileInterface;
 }
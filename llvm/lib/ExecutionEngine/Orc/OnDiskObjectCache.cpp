@@ -0,0 +1,124 @@
+//===------ OnDiskObjectCache.cpp - Content-addressed JIT object cache ----===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/Orc/OnDiskObjectCache.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_sha1_ostream.h"
+#include "llvm/Target/TargetMachine.h"
+
+#define DEBUG_TYPE "orc"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+Expected<std::unique_ptr<OnDiskObjectCache>>
+OnDiskObjectCache::Create(StringRef CacheDir, const TargetMachine &TM) {
+  if (auto EC = sys::fs::create_directories(CacheDir))
+    return createFileError(CacheDir, EC);
+
+  std::string TargetKey;
+  raw_string_ostream OS(TargetKey);
+  OS << TM.getTargetTriple().str() << '\0' << TM.getTargetCPU() << '\0'
+     << TM.getTargetFeatureString() << '\0'
+     << static_cast<int>(TM.getOptLevel()) << '\0'
+     << static_cast<int>(TM.getRelocationModel()) << '\0'
+     << static_cast<int>(TM.getCodeModel());
+
+  // Options that change the contents of the emitted object without showing up
+  // in the triple, CPU or features.
+  const TargetOptions &Opts = TM.Options;
+  OS << '\0' << static_cast<int>(Opts.FloatABIType) << '\0'
+     << static_cast<int>(Opts.ExceptionModel) << '\0'
+     << static_cast<int>(Opts.ThreadModel) << '\0'
+     << static_cast<int>(Opts.EABIVersion) << '\0'
+     << static_cast<int>(Opts.DebuggerTuning) << '\0' << Opts.EmulatedTLS
+     << Opts.EnableTLSDESC << Opts.FunctionSections << Opts.DataSections
+     << Opts.UniqueSectionNames << Opts.UseInitArray << Opts.TrapUnreachable
+     << Opts.NoTrapAfterNoreturn << '\0' << Opts.TLSSize;
+
+  const MCTargetOptions &MCOpts = Opts.MCOptions;
+  OS << '\0' << MCOpts.MCRelaxAll << MCOpts.MCNoExecStack
+     << MCOpts.MCIncrementalLinkerCompatible << MCOpts.FDPIC << MCOpts.Dwarf64
+     << MCOpts.Crel << MCOpts.ImplicitMapSyms << MCOpts.X86RelaxRelocations
+     << MCOpts.X86Sse2Avx << '\0'
+     << static_cast<int>(MCOpts.EmitDwarfUnwind) << '\0'
+     << static_cast<int>(MCOpts.CompressDebugSections) << '\0'
+     << MCOpts.ABIName;
+
+  return std::unique_ptr<OnDiskObjectCache>(
+      new OnDiskObjectCache(CacheDir.str(), std::move(TargetKey)));
+}
+
+std::string OnDiskObjectCache::getCacheFilePath(const Module &M) const {
+  raw_sha1_ostream Hasher;
+  Hasher << TargetKey << '\0';
+  WriteBitcodeToFile(M, Hasher);
+
+  SmallString<128> Path(CacheDir);
+  sys::path::append(Path, "llvmcache-" + toHex(Hasher.sha1()));
+  return std::string(Path);
+}
+
+std::unique_ptr<MemoryBuffer> OnDiskObjectCache::getObject(const Module *M) {
+  std::string Path = getCacheFilePath(*M);
+
+  auto Buf = MemoryBuffer::getFile(Path, /*IsText=*/false,
+                                   /*RequiresNullTerminator=*/false);
+  if (Buf) {
+    LLVM_DEBUG(dbgs() << "OnDiskObjectCache: hit for "
+                      << M->getModuleIdentifier() << " in " << Path << "\n");
+    return std::move(*Buf);
+  }
+
+  LLVM_DEBUG(dbgs() << "OnDiskObjectCache: miss for "
+                    << M->getModuleIdentifier() << "\n");
+  std::lock_guard<std::mutex> Lock(PendingMutex);
+  PendingPaths[M] = std::move(Path);
+  return nullptr;
+}
+
+void OnDiskObjectCache::notifyObjectCompiled(const Module *M,
+                                             MemoryBufferRef Obj) {
+  std::string Path;
+  {
+    std::lock_guard<std::mutex> Lock(PendingMutex);
+    auto I = PendingPaths.find(M);
+    if (I == PendingPaths.end())
+      return;
+    Path = std::move(I->second);
+    PendingPaths.erase(I);
+  }
+
+  // Write through a temporary file so that concurrent readers never see a
+  // partially written object. A failure to populate the cache is not fatal.
+  if (auto Err = writeToOutput(Path, [&](raw_ostream &OS) {
+        OS << Obj.getBuffer();
+        return Error::success();
+      })) {
+    LLVM_DEBUG(dbgs() << "OnDiskObjectCache: failed to write " << Path << ": "
+                      << toString(std::move(Err)) << "\n");
+    consumeError(std::move(Err));
+    return;
+  }
+  LLVM_DEBUG(dbgs() << "OnDiskObjectCache: wrote " << Path << "\n");
+}
+
+bool OnDiskObjectCache::prune(const CachePruningPolicy &Policy) {
+  bool Pruned = pruneCache(CacheDir, Policy);
+  LLVM_DEBUG({
+    if (!Pruned)
+      dbgs() << "OnDiskObjectCache: failed to prune " << CacheDir << "\n";
+  });
+  return Pruned;
+}
@@ -83,6 +83,21 @@ Error ReOptimizeLayer::reoptimizeIfCallFrequent(ReOptimizeLayer &Parent,
                                                 ReOptMaterializationUnitID MUID,
                                                 unsigned CurVersion,
                                                 ThreadSafeModule &TSM) {
+  return addCallCountProfiler(MUID, CurVersion, TSM, CallCountThreshold);
+}
+
+ReOptimizeLayer::AddProfilerFunc
+ReOptimizeLayer::reoptimizeIfCallCountExceeds(uint64_t Threshold) {
+  return [Threshold](ReOptimizeLayer &Parent, ReOptMaterializationUnitID MUID,
+                     unsigned CurVersion, ThreadSafeModule &TSM) {
+    return addCallCountProfiler(MUID, CurVersion, TSM, Threshold);
+  };
+}
+
+Error ReOptimizeLayer::addCallCountProfiler(ReOptMaterializationUnitID MUID,
+                                            unsigned CurVersion,
+                                            ThreadSafeModule &TSM,
+                                            uint64_t Threshold) {
   return TSM.withModuleDo([&](Module &M) -> Error {
     Type *I64Ty = Type::getInt64Ty(M.getContext());
     GlobalVariable *Counter = new GlobalVariable(
@@ -100,10 +115,10 @@ Error ReOptimizeLayer::reoptimizeIfCallFrequent(ReOptimizeLayer &Parent,
       auto &BB = F.getEntryBlock();
       auto *IP = &*BB.getFirstInsertionPt();
       IRBuilder<> IRB(IP);
-      Value *Threshold = ConstantInt::get(I64Ty, CallCountThreshold, true);
+      Value *ThresholdVal = ConstantInt::get(I64Ty, Threshold, true);
       Value *Cnt = IRB.CreateLoad(I64Ty, Counter);
       // Use EQ to prevent further reoptimize calls.
-      Value *Cmp = IRB.CreateICmpEQ(Cnt, Threshold);
+      Value *Cmp = IRB.CreateICmpEQ(Cnt, ThresholdVal);
       Value *Added = IRB.CreateAdd(Cnt, ConstantInt::get(I64Ty, 1));
       (void)IRB.CreateStore(Added, Counter);
       Instruction *SplitTerminator = SplitBlockAndInsertIfThen(Cmp, IP, false);
@@ -3157,6 +3157,10 @@ void AssemblyWriter::printModule(const Module *M) {
     printIFunc(&GI);
 
   // Output all of the functions.
+  // FIXME: Functions are printed serially. Numbering is mostly per function,
+  // but the module-level SlotTracker assigns metadata slots in visiting order
+  // (including metadata first referenced from function bodies), so printing
+  // bodies independently would not reproduce today's output byte for byte.
   for (const Function &F : *M) {
     Out << '\n';
     printFunction(&F);
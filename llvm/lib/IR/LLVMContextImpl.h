@@ -1661,6 +1661,9 @@ public:
 
   DenseMap<const Value *, ValueName *> ValueNames;
 
+  // The constant, type and metadata uniquing tables below are unsynchronized.
+  // Creating IR through them is only safe from one thread at a time; clients
+  // wanting parallelism must use one LLVMContext per thread.
   DenseMap<unsigned, std::unique_ptr<ConstantInt>> IntZeroConstants;
   DenseMap<unsigned, std::unique_ptr<ConstantInt>> IntOneConstants;
   DenseMap<APInt, std::unique_ptr<ConstantInt>> IntConstants;
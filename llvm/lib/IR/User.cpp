@@ -141,6 +141,10 @@ void *User::allocateFixedOperandUser(size_t Size, unsigned Us,
   assert(DescBytesToAllocate % sizeof(void *) == 0 &&
          "We need this to satisfy alignment constraints for Uses");
 
+  // FIXME: Every User is a separate global heap allocation. Carving them out
+  // of a per-Function arena would need ownership of the storage to follow
+  // the User when it is moved between functions (splicing, inlining, cloning)
+  // or outlives its parent, which the current IR APIs allow.
   uint8_t *Storage = static_cast<uint8_t *>(
       ::operator new(Size + sizeof(Use) * Us + DescBytesToAllocate));
   Use *Start = reinterpret_cast<Use *>(Storage + DescBytesToAllocate);
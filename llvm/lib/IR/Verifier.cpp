@@ -7436,6 +7436,11 @@ bool llvm::verifyModule(const Module &M, raw_ostream *OS,
   // Don't use a raw_null_ostream.  Printing IR is expensive.
   Verifier V(OS, /*ShouldTreatBrokenDebugInfoAsError=*/!BrokenDebugInfo, M);
 
+  // FIXME: Functions are verified one after another by a single Verifier. The
+  // per-function visit also records module-wide state (visited metadata,
+  // DISubprogram attachments, comdat and global uses) that the final module
+  // check consumes, so verifying functions concurrently would first require
+  // splitting that state into per-function pieces that can be merged.
   bool Broken = false;
   for (const Function &F : M)
     Broken |= !V.verify(F);
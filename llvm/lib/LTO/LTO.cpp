@@ -111,6 +111,10 @@ std::string llvm::computeLTOCacheKey(
   // This is based on the current compiler version, the module itself, the
   // export list, the hash for every single module in the import list, the
   // list of ResolvedODR for the module, and the list of preserved symbols.
+  // FIXME: The key covers the whole module, so any change to one function
+  // invalidates the entry. Caching at function granularity would need a
+  // per-function hash that also covers every declaration and type the body
+  // refers to, and a way to splice cached machine code back into a module.
   SHA1 Hasher;
 
   // Start with the compiler revision
@@ -2035,6 +2039,12 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
 
   generateParamAccessSummary(ThinLTO.CombinedIndex);
 
+  // FIXME: Backends only start once every index-wide analysis above has run.
+  // A module's import list is known after ComputeCrossModuleImport, but its
+  // cache key and its backend also depend on ResolvedODR, on the
+  // internalization and WPD export decisions and on the propagated function
+  // attributes, any of which can still change because of other modules, so
+  // no module is final any earlier than this point.
   if (llvm::timeTraceProfilerEnabled())
     llvm::timeTraceProfilerEnd();
 
@@ -486,6 +486,12 @@ static void splitCodeGen(const Config &C, TargetMachine *TM,
         // spinning up new threads which deserialize the partitions into
         // separate contexts.
         // FIXME: Provide a more direct way to do this in LLVM.
+        // FIXME: Partitioning is the only source of parallelism here and it
+        // costs cross-partition inlining and layout. Running ISel through the
+        // pre-emit passes per MachineFunction on worker threads, with only
+        // AsmPrinter serialized in function order, would avoid the split, but
+        // every MachineFunction pass still shares the module's LLVMContext,
+        // MCContext and MachineModuleInfo, none of which are thread-safe.
         SmallString<0> BC;
         raw_svector_ostream BCOS(BC);
         WriteBitcodeToFile(*MPart, BCOS);
@@ -1038,6 +1038,9 @@ Error IRLinker::linkFunctionBody(Function &Dst, Function &Src) {
   Dst.splice(Dst.end(), &Src);
 
   // Everything has been moved over.  Remap it.
+  // FIXME: Remapping runs serially through the shared ValueMapper. It creates
+  // constants and uniqued metadata in the destination context as it goes,
+  // which is what prevents remapping several function bodies concurrently.
   Mapper.scheduleRemapFunction(Dst);
   return Error::success();
 }
@@ -1038,6 +1038,10 @@ uint64_t ELFWriter::writeObject() {
       continue;
 
     // Remember the offset into the file for this section.
+    // FIXME: Offsets are discovered by writing, so sections are serialized in
+    // order. Writing them in parallel needs every size up front, but the size
+    // of a compressed debug section is only known after compressing it, and
+    // the relocation and group sections are created while this loop runs.
     const uint64_t SecStart = align(Section.getAlign());
 
     const MCSymbolELF *SignatureSymbol = Section.getGroup();
@@ -1250,6 +1250,10 @@ bool MCAssembler::relaxOnce() {
       ChangedAny |= Changed;
       if (!Changed || --MaxIter == 0)
         break;
+      // FIXME: Only fragments at or after the first one that grew can move,
+      // so the layout could restart there. That is not safe in general
+      // because an earlier org fragment may be sized by an expression that
+      // refers to a later label in the same section.
       layoutSection(Sec);
     }
   }
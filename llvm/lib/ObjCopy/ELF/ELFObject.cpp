@@ -461,7 +461,6 @@ template <class ELFT>
 Error ELFSectionWriter<ELFT>::visit(const DecompressedSection &Sec) {
   ArrayRef<uint8_t> Compressed =
       Sec.OriginalData.slice(sizeof(Elf_Chdr_Impl<ELFT>));
-  SmallVector<uint8_t, 128> Decompressed;
   DebugCompressionType Type;
   switch (Sec.ChType) {
   case ELFCOMPRESS_ZLIB:
@@ -481,15 +480,16 @@ Error ELFSectionWriter<ELFT>::visit(const DecompressedSection &Sec) {
     return createStringError(errc::invalid_argument,
                              "failed to decompress section '" + Sec.Name +
                                  "': " + Reason);
-  if (Error E = compression::decompress(Type, Compressed, Decompressed,
+
+  // Decompress straight into the output buffer rather than into a temporary
+  // that would then have to be copied.
+  uint8_t *Buf = reinterpret_cast<uint8_t *>(Out.getBufferStart()) + Sec.Offset;
+  if (Error E = compression::decompress(Type, Compressed, Buf,
                                         static_cast<size_t>(Sec.Size)))
     return createStringError(errc::invalid_argument,
                              "failed to decompress section '" + Sec.Name +
                                  "': " + toString(std::move(E)));
 
-  uint8_t *Buf = reinterpret_cast<uint8_t *>(Out.getBufferStart()) + Sec.Offset;
-  llvm::copy(Decompressed, Buf);
-
   return Error::success();
 }
 
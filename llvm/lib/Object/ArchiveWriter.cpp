@@ -845,6 +845,11 @@ computeMemberData(raw_ostream &StringTable, raw_ostream &SymNames,
 
   std::vector<std::unique_ptr<SymbolicFile>> SymFiles;
 
+  // FIXME: Members are opened one at a time and every bitcode member is
+  // parsed into the single shared Context, so this loop cannot be run in
+  // parallel as is. Each worker would need its own LLVMContext for IR
+  // members, and the lazy-loaded modules would have to outlive this function
+  // alongside their contexts.
   if (NeedSymbols != SymtabWritingMode::NoSymtab || isAIXBigArchive(Kind)) {
     for (const NewArchiveMember &M : NewMembers) {
       Expected<std::unique_ptr<SymbolicFile>> SymFileOrErr = getSymbolicFile(
@@ -573,6 +573,10 @@ PassBuilder::buildFunctionSimplificationPipeline(OptimizationLevel Level,
 
   // The O1 pipeline has a separate pipeline creation function to simplify
   // construction readability.
+  // FIXME: The pipeline is chosen once per module from the optimization level.
+  // There is no way to fall back to the cheaper O1 pipeline for individual
+  // functions that exceed a compile-time budget, since passes have no shared
+  // notion of elapsed time or size budget to consult.
   if (Level.getSpeedupLevel() == 1)
     return buildO1FunctionSimplificationPipeline(Level, Phase);
 
@@ -962,6 +962,11 @@ data_type InstrProfLookupTrait::ReadData(StringRef K, const unsigned char *D,
       CountsSize = endian::readNext<uint64_t, llvm::endianness::little>(D);
     }
     // Read counter values.
+    // FIXME: The counters are copied out of the mapped file even though they
+    // are stored as little-endian uint64_t. Handing out an ArrayRef into the
+    // mapping would avoid the copy on little-endian hosts, but the entries
+    // are not guaranteed to be 8-byte aligned and InstrProfRecord owns and
+    // mutates its counts (e.g. when scaling or merging).
     if (D + CountsSize * sizeof(uint64_t) > End)
       return data_type();
 
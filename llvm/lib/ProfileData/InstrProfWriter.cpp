@@ -393,6 +393,10 @@ void InstrProfWriter::mergeRecordsFromWriter(InstrProfWriter &&IPW,
   for (auto &I : IPW.FunctionData)
     for (auto &Func : I.getValue())
       addRecord(I.getKey(), Func.first, std::move(Func.second), 1, Warn);
+  // The records have been moved out; release the source's name table now
+  // rather than when IPW is destroyed, which may be much later when merging
+  // many writers.
+  IPW.FunctionData.clear();
 
   BinaryIds.reserve(BinaryIds.size() + IPW.BinaryIds.size());
   for (auto &I : IPW.BinaryIds)
@@ -322,6 +322,11 @@ static bool ParseLine(const StringRef &Input, LineType &LineTy, uint32_t &Depth,
 /// the expected format.
 ///
 /// \returns true if the file was loaded successfully, false otherwise.
+// FIXME: The text format has no function offset table, so the whole file is
+// parsed even when only a few functions are wanted. Profiles that are large
+// enough for this to matter should be converted to the extensible binary
+// format, whose reader already loads functions on demand (see
+// SampleProfileReaderExtBinaryBase::readFuncProfiles).
 std::error_code SampleProfileReaderText::readImpl() {
   line_iterator LineIt(*Buffer, /*SkipBlanks=*/true, '#');
   sampleprof_error Result = sampleprof_error::success;
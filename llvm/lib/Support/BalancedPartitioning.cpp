@@ -233,6 +233,7 @@ unsigned BalancedPartitioning::runIteration(const FunctionNodeRange Nodes,
   // Compute move gains
   typedef std::pair<float, BPFunctionNode *> GainPair;
   std::vector<GainPair> Gains;
+  Gains.reserve(std::distance(Nodes.begin(), Nodes.end()));
   for (auto &N : Nodes) {
     bool FromLeftToRight = (N.Bucket == LeftBucket);
     float Gain = moveGain(N, FromLeftToRight, Signatures);
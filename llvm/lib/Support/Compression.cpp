@@ -50,7 +50,7 @@ void compression::compress(Params P, ArrayRef<uint8_t> Input,
     zlib::compress(Input, Output, P.level);
     break;
   case compression::Format::Zstd:
-    zstd::compress(Input, Output, P.level, P.zstdEnableLdm);
+    zstd::compress(Input, Output, P.level, P.zstdEnableLdm, P.zstdNumWorkers);
     break;
   }
 }
@@ -167,7 +167,7 @@ bool zstd::isAvailable() { return true; }
 
 void zstd::compress(ArrayRef<uint8_t> Input,
                     SmallVectorImpl<uint8_t> &CompressedBuffer, int Level,
-                    bool EnableLdm) {
+                    bool EnableLdm, unsigned NumWorkers) {
   ZSTD_CCtx *Cctx = ZSTD_createCCtx();
   if (!Cctx)
     report_bad_alloc_error("Failed to create ZSTD_CCtx");
@@ -184,6 +184,11 @@ void zstd::compress(ArrayRef<uint8_t> Input,
     report_bad_alloc_error("Failed to set ZSTD_c_compressionLevel");
   }
 
+  // This fails if libzstd was built without ZSTD_MULTITHREAD, in which case
+  // compression stays on this thread.
+  if (NumWorkers)
+    (void)ZSTD_CCtx_setParameter(Cctx, ZSTD_c_nbWorkers, NumWorkers);
+
   unsigned long CompressedBufferSize = ZSTD_compressBound(Input.size());
   CompressedBuffer.resize_for_overwrite(CompressedBufferSize);
 
@@ -229,7 +234,7 @@ Error zstd::decompress(ArrayRef<uint8_t> Input,
 bool zstd::isAvailable() { return false; }
 void zstd::compress(ArrayRef<uint8_t> Input,
                     SmallVectorImpl<uint8_t> &CompressedBuffer, int Level,
-                    bool EnableLdm) {
+                    bool EnableLdm, unsigned NumWorkers) {
   llvm_unreachable("zstd::compress is unavailable");
 }
 Error zstd::decompress(ArrayRef<uint8_t> Input, uint8_t *Output,
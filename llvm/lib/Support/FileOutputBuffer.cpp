@@ -132,6 +132,12 @@ createOnDiskBuffer(StringRef Path, size_t Size, unsigned Mode) {
     return FileOrErr.takeError();
   fs::TempFile File = std::move(*FileOrErr);
 
+  // FIXME: The file is only extended, not preallocated, so every page of the
+  // mapping takes a fault (and a block allocation) on first write. Explicit
+  // preallocation is deliberately avoided here because posix_fallocate falls
+  // back to writing zeros on filesystems without native support, which is far
+  // slower than faulting; a Linux-only fallocate() that ignores EOPNOTSUPP
+  // would be the safe way to add it.
   if (auto EC = fs::resize_file_before_mapping_readwrite(File.FD, Size)) {
     consumeError(File.discard());
     return errorCodeToError(EC);
@@ -21,15 +21,37 @@
 
 using namespace llvm;
 
+// Emit two digits per division; this halves the number of (64-bit) divides
+// on the hot integer printing path.
+static constexpr char DigitPairs[] = "00010203040506070809"
+                                     "10111213141516171819"
+                                     "20212223242526272829"
+                                     "30313233343536373839"
+                                     "40414243444546474849"
+                                     "50515253545556575859"
+                                     "60616263646566676869"
+                                     "70717273747576777879"
+                                     "80818283848586878889"
+                                     "90919293949596979899";
+
 template<typename T, std::size_t N>
 static int format_to_buffer(T Value, char (&Buffer)[N]) {
   char *EndPtr = std::end(Buffer);
   char *CurPtr = EndPtr;
 
-  do {
-    *--CurPtr = '0' + char(Value % 10);
-    Value /= 10;
-  } while (Value);
+  while (Value >= 100) {
+    unsigned Pair = unsigned(Value % 100) * 2;
+    Value /= 100;
+    *--CurPtr = DigitPairs[Pair + 1];
+    *--CurPtr = DigitPairs[Pair];
+  }
+  if (Value >= 10) {
+    unsigned Pair = unsigned(Value) * 2;
+    *--CurPtr = DigitPairs[Pair + 1];
+    *--CurPtr = DigitPairs[Pair];
+  } else {
+    *--CurPtr = '0' + char(Value);
+  }
   return EndPtr - CurPtr;
 }
 
@@ -59,6 +81,20 @@ static void write_unsigned_impl(raw_ostream &S, T N, size_t MinDigits,
   char NumberBuffer[128];
   size_t Len = format_to_buffer(N, NumberBuffer);
 
+  // Put the sign and any zero padding in front of the digits so that the
+  // common case is a single write to the stream.
+  if (Style != IntegerStyle::Number) {
+    size_t Pad = MinDigits > Len ? MinDigits - Len : 0;
+    if (Len + Pad + IsNegative <= std::size(NumberBuffer)) {
+      char *CurPtr = std::end(NumberBuffer) - Len - Pad;
+      ::memset(CurPtr, '0', Pad);
+      if (IsNegative)
+        *--CurPtr = '-';
+      S.write(CurPtr, std::end(NumberBuffer) - CurPtr);
+      return;
+    }
+  }
+
   if (IsNegative)
     S << '-';
 
@@ -147,7 +183,7 @@ void llvm::write_hex(raw_ostream &S, uint64_t N, HexPrintStyle Style,
       std::max(static_cast<unsigned>(W), std::max(1u, Nibbles) + PrefixChars);
 
   char NumberBuffer[kMaxWidth];
-  ::memset(NumberBuffer, '0', std::size(NumberBuffer));
+  ::memset(NumberBuffer, '0', NumChars);
   if (Prefix)
     NumberBuffer[1] = 'x';
   char *EndPtr = NumberBuffer + NumChars;
@@ -178,6 +178,12 @@ size_t getThreadCount() {
 // lock if all threads in the default executor are blocked. To prevent the dead
 // lock, only allow the root TaskGroup to run tasks parallelly. In the scenario
 // of nested parallel_for_each(), only the outermost one runs parallelly.
+//
+// FIXME: Lifting this restriction needs a waiting thread to run queued tasks
+// instead of blocking in Latch::sync(). With the single shared WorkStack that
+// means taking the executor lock on every help attempt, so it pairs naturally
+// with per-worker deques and stealing, which would also remove the central
+// lock from add().
 TaskGroup::TaskGroup()
 #if LLVM_ENABLE_THREADS
     : Parallel((parallel::strategy.ThreadsRequested != 1) &&
@@ -114,6 +114,12 @@ int llvm::TableGenMain(const char *argv0,
     Timer.startPhaseTiming();
 
   // Parse the input file.
+  //
+  // FIXME: Every backend invocation for a target re-parses and re-resolves
+  // the same .td files. The RecordKeeper has no serialized form, and Init
+  // objects are uniqued by pointer in a per-keeper context, so a snapshot
+  // would need its own (de)serializer for the whole Init hierarchy rather
+  // than a memory dump.
 
   Timer.startTimer("Parse, build records");
   ErrorOr<std::unique_ptr<MemoryBuffer>> FileOrErr =
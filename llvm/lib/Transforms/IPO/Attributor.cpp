@@ -2116,6 +2116,12 @@ void Attributor::runTillFixpoint() {
 
   // Now that all abstract attributes are collected and initialized we start
   // the abstract analysis.
+  //
+  // FIXME: The dependence graph and every abstract attribute state are
+  // rebuilt from scratch for each run. Seeding them from a previous run (or
+  // from a ThinLTO summary) would need a stable, serializable identity for
+  // IRPositions and abstract attributes, which today are keyed on in-memory
+  // Value pointers.
 
   unsigned IterationCounter = 1;
   unsigned MaxIterations =
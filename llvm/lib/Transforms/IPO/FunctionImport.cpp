@@ -40,6 +40,7 @@
 #include "llvm/Support/JSON.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO/Internalize.h"
 #include "llvm/Transforms/Utils/Cloning.h"
@@ -1221,8 +1222,13 @@ void llvm::ComputeCrossModuleImport(
         isPrevailing,
     FunctionImporter::ImportListsTy &ImportLists,
     DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists) {
+  TimeTraceScope TimeScope("ComputeCrossModuleImport");
   auto MIS = ModuleImportsManager::create(isPrevailing, Index, &ExportLists);
   // For each module that has function defined, compute the import/export lists.
+  // FIXME: The per-module import computations only read the index, but they
+  // all insert into the shared ExportLists (and the ImportLists' shared ID
+  // table), so they cannot run in parallel without per-thread export sets
+  // that are merged afterwards.
   for (const auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
     auto &ImportList = ImportLists[DefinedGVSummaries.first];
     LLVM_DEBUG(dbgs() << "Computing import for Module '"
@@ -1433,6 +1439,7 @@ void llvm::computeDeadSymbolsAndUpdateIndirectCalls(
     ModuleSummaryIndex &Index,
     const DenseSet<GlobalValue::GUID> &GUIDPreservedSymbols,
     function_ref<PrevailingType(GlobalValue::GUID)> isPrevailing) {
+  TimeTraceScope TimeScope("ComputeDeadSymbols");
   assert(!Index.withGlobalValueDeadStripping());
   if (!ComputeDead ||
       // Don't do anything when nothing is live, this is friendly with tests.
@@ -1552,8 +1559,10 @@ void llvm::computeDeadSymbolsWithConstProp(
     bool ImportEnabled) {
   computeDeadSymbolsAndUpdateIndirectCalls(Index, GUIDPreservedSymbols,
                                            isPrevailing);
-  if (ImportEnabled)
+  if (ImportEnabled) {
+    TimeTraceScope TimeScope("PropagateAttributes");
     Index.propagateAttributes(GUIDPreservedSymbols);
+  }
 }
 
 /// Compute the set of summaries needed for a ThinLTO backend compilation of
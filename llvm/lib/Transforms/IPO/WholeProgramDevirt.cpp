@@ -2528,6 +2528,15 @@ void DevirtIndex::run() {
     ExportSummary.getOrInsertTypeIdSummary(P.first);
   }
 
+  // Look up the type id names for a GUID without inserting an empty entry for
+  // every vcall GUID that has no compatible vtables.
+  auto NamesForGUID = [&](GlobalValue::GUID GUID) -> ArrayRef<StringRef> {
+    auto I = NameByGUID.find(GUID);
+    if (I == NameByGUID.end())
+      return {};
+    return I->second;
+  };
+
   // Collect information from summary about which calls to try to devirtualize.
   for (auto &P : ExportSummary) {
     for (auto &S : P.second.SummaryList) {
@@ -2536,18 +2545,18 @@ void DevirtIndex::run() {
         continue;
       // FIXME: Only add live functions.
       for (FunctionSummary::VFuncId VF : FS->type_test_assume_vcalls()) {
-        for (StringRef Name : NameByGUID[VF.GUID]) {
+        for (StringRef Name : NamesForGUID(VF.GUID)) {
           CallSlots[{Name, VF.Offset}].CSInfo.addSummaryTypeTestAssumeUser(FS);
         }
       }
       for (FunctionSummary::VFuncId VF : FS->type_checked_load_vcalls()) {
-        for (StringRef Name : NameByGUID[VF.GUID]) {
+        for (StringRef Name : NamesForGUID(VF.GUID)) {
           CallSlots[{Name, VF.Offset}].CSInfo.addSummaryTypeCheckedLoadUser(FS);
         }
       }
       for (const FunctionSummary::ConstVCall &VC :
            FS->type_test_assume_const_vcalls()) {
-        for (StringRef Name : NameByGUID[VC.VFunc.GUID]) {
+        for (StringRef Name : NamesForGUID(VC.VFunc.GUID)) {
           CallSlots[{Name, VC.VFunc.Offset}]
               .ConstCSInfo[VC.Args]
               .addSummaryTypeTestAssumeUser(FS);
@@ -2555,7 +2564,7 @@ void DevirtIndex::run() {
       }
       for (const FunctionSummary::ConstVCall &VC :
            FS->type_checked_load_const_vcalls()) {
-        for (StringRef Name : NameByGUID[VC.VFunc.GUID]) {
+        for (StringRef Name : NamesForGUID(VC.VFunc.GUID)) {
           CallSlots[{Name, VC.VFunc.Offset}]
               .ConstCSInfo[VC.Args]
               .addSummaryTypeCheckedLoadUser(FS);
@@ -95,6 +95,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/KnownBits.h"
 #include "llvm/Support/KnownFPClass.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/InstCombine/InstCombine.h"
 #include "llvm/Transforms/Utils/BasicBlockUtils.h"
@@ -121,6 +122,8 @@ STATISTIC(NumTwoIterations, "Number of functions with two iterations");
 STATISTIC(NumThreeIterations, "Number of functions with three iterations");
 STATISTIC(NumFourOrMoreIterations,
           "Number of functions with four or more iterations");
+STATISTIC(NumIterationLimitReached,
+          "Number of functions where the iteration limit was reached");
 
 STATISTIC(NumCombined , "Number of insts combined");
 STATISTIC(NumConstProp, "Number of constant folds");
@@ -5662,11 +5665,20 @@ static bool combineInstructionsOverFunction(
       LLVM_DEBUG(dbgs() << "\n\n[IC] Iteration limit #" << Opts.MaxIterations
                         << " on " << F.getName()
                         << " reached; stopping without verifying fixpoint\n");
+      ++NumIterationLimitReached;
+      ORE.emit([&]() {
+        return OptimizationRemarkAnalysis(DEBUG_TYPE, "IterationLimitReached",
+                                          &F)
+               << "stopped after reaching the iteration limit of "
+               << ore::NV("MaxIterations", Opts.MaxIterations)
+               << " without verifying a fixpoint";
+      });
       break;
     }
 
     ++Iteration;
     ++NumWorklistIterations;
+    TimeTraceScope TimeScope("InstCombineIteration", F.getName());
     LLVM_DEBUG(dbgs() << "\n\nINSTCOMBINE ITERATION #" << Iteration << " on "
                       << F.getName() << "\n");
 
@@ -1948,6 +1948,10 @@ bool GVNPass::processNonLocalLoad(LoadInst *Load) {
     return false;
 
   // Step 1: Find the non-local dependencies of the load.
+  // FIXME: This still goes through MemoryDependenceAnalysis even when
+  // -enable-gvn-memoryssa is set; MemorySSA is only kept up to date here.
+  // Answering this query with a MemorySSA walker is what would let GVN drop
+  // MemDep's unbounded non-local pointer caches.
   LoadDepVect Deps;
   MD->getNonLocalPointerDependency(Load, Deps);
 
@@ -965,10 +965,13 @@ mayLoopAccessLocation(Value *Ptr, ModRefInfo Access, Loop *L,
   // which will then no-alias a store to &A[100].
   MemoryLocation StoreLoc(Ptr, AccessSize);
 
+  // Every instruction in the loop is queried against the same location and the
+  // IR does not change in between, so share one alias cache across the scan.
+  BatchAAResults BatchAA(AA);
   for (BasicBlock *B : L->blocks())
     for (Instruction &I : *B)
       if (!IgnoredInsts.contains(&I) &&
-          isModOrRefSet(AA.getModRefInfo(&I, StoreLoc) & Access))
+          isModOrRefSet(BatchAA.getModRefInfo(&I, StoreLoc) & Access))
         return true;
   return false;
 }
@@ -745,6 +745,11 @@ private:
       return std::make_tuple(A1->Id, B1->Id) < std::make_tuple(A2->Id, B2->Id);
     };
 
+    // FIXME: Every merge rescans all hot chain pairs, which is quadratic in
+    // the number of hot chains even though most merge gains are cached. A
+    // gain-ordered queue of edges, as in CDSortImpl::mergeChainPairs, would
+    // only revisit the edges of the two merged chains, but it must reproduce
+    // the EPS-based tie-breaking below to keep layouts stable.
     while (HotChains.size() > 1) {
       ChainT *BestChainPred = nullptr;
       ChainT *BestChainSucc = nullptr;
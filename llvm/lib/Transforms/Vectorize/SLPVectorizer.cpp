@@ -111,6 +111,8 @@ using namespace std::placeholders;
 #define DEBUG_TYPE "SLP"
 
 STATISTIC(NumVectorInstructions, "Number of vector instructions generated");
+STATISTIC(NumScheduleRegionLimitHit,
+          "Number of bundles rejected by the schedule region size limit");
 
 DEBUG_COUNTER(VectorizedGraphs, "slp-vectorized",
               "Controls which SLP graphs should be vectorized.");
@@ -19517,8 +19519,15 @@ bool BoUpSLP::BlockScheduling::extendSchedulingRegion(
   DownIter = std::find_if_not(DownIter, LowerEnd, IsAssumeLikeIntr);
   while (UpIter != UpperEnd && DownIter != LowerEnd && &*UpIter != I &&
          &*DownIter != I) {
+    // FIXME: The region only grows, so in a very large straight-line block
+    // every new bundle far from the current region pays for the walk and
+    // eventually exhausts the budget, rejecting all later bundles in the
+    // block. Resetting the region around new seeds (a sliding window) would
+    // keep this near-linear, but dependencies computed for the old region
+    // would have to be dropped first.
     if (++ScheduleRegionSize > ScheduleRegionSizeLimit) {
       LLVM_DEBUG(dbgs() << "SLP:  exceeded schedule region size limit\n");
+      ++NumScheduleRegionLimitHit;
       return false;
     }
 
@@ -831,6 +831,13 @@ bool DwarfLinkerForBinary::linkImpl(
       continue;
     }
 
+    // FIXME: Every object is loaded and relinked on every run, even if it is
+    // unchanged since the previous dSYM. Reusing linked fragments per object
+    // is not a local change: with ODR uniquing, what an object contributes
+    // depends on the types already seen in earlier objects, and its final
+    // offsets, string offsets and accelerator table entries depend on the
+    // whole link. A cache would have to be keyed on the object's contents and
+    // on the uniquing state it was linked against.
     auto DLBRelocMap = std::make_shared<DwarfLinkerForBinaryRelocationMap>();
     if (ErrorOr<std::unique_ptr<DWARFFile>> ErrorOrObj =
             loadObject(*Obj, Map, RL, DLBRelocMap)) {
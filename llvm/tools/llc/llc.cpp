@@ -557,6 +557,10 @@ static int compileModule(char **argv, LLVMContext &Context) {
       if (MIR)
         M = MIR->parseIRModule(SetDataLayout);
     } else {
+      // FIXME: Bitcode input is fully materialized here. Module passes in the
+      // codegen pipeline (and AsmPrinter's module-level emission) expect every
+      // function body to be present, so bodies cannot yet be materialized on
+      // demand right before each function is code generated.
       M = parseIRFile(InputFilename, Err, Context,
                       ParserCallbacks(SetDataLayout));
     }
@@ -325,6 +325,11 @@ void CoverageExporterJson::renderRoot(ArrayRef<std::string> SourceFiles) {
   FileCoverageSummary Totals = FileCoverageSummary("Totals");
   auto FileReports = CoverageReport::prepareFileReports(Coverage, Totals,
                                                         SourceFiles, Options);
+  // FIXME: Every file's segments, branches and expansions are held as
+  // json::Values until the whole document is printed. Streaming through
+  // json::OStream would bound that, but files are rendered in parallel in
+  // completion order and sorted afterwards, and the printed keys are sorted,
+  // so a streaming exporter would have to render files in name order.
   auto Files = renderFiles(Coverage, SourceFiles, FileReports, Options);
   // Sort files in order of their names.
   llvm::sort(Files, [](const json::Value &A, const json::Value &B) {
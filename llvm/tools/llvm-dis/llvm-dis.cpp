@@ -219,6 +219,9 @@ int main(int argc, char **argv) {
       std::unique_ptr<Module> M;
 
       if (!PrintThinLTOIndexOnly) {
+        // FIXME: The whole module is materialized before printing. Printing
+        // one function at a time would bound memory, but AsmWriter needs the
+        // module-wide metadata numbering, which requires visiting every body.
         M = ExitOnErr(
             MB.getLazyModule(Context, MaterializeMetadata, SetImporting));
         if (MaterializeMetadata)
@@ -612,6 +612,11 @@ int main(int argc, char **argv) {
 
   json::Object JSONOutput;
   int NonEmptyRegions = 0;
+  // FIXME: Regions are independent, but they are simulated one after another
+  // because the instruction builder, the custom behaviour and instrument
+  // managers, the post processor and the code emitter above are stateful and
+  // shared. Simulating regions in parallel would need one set per thread and
+  // would have to emit the reports in region order.
   for (const std::unique_ptr<mca::AnalysisRegion> &Region : Regions) {
     // Skip empty code regions.
     if (Region->empty())
@@ -533,6 +533,10 @@ static std::string getContextKeyStr(ContextKey *K,
 }
 
 void HybridPerfReader::unwindSamples() {
+  // FIXME: The aggregated samples are independent, but the unwinder records
+  // every context into the one SampleCounters map and caches frames in the
+  // shared ProfiledBinary, so unwinding runs on a single thread. Parallel
+  // unwinding would need per-thread counter maps merged by context key.
   VirtualUnwinder Unwinder(&SampleCounters, Binary);
   for (const auto &Item : AggregatedSamples) {
     const PerfSample *Sample = Item.first.getPtr();
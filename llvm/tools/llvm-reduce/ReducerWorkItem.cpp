@@ -8,6 +8,7 @@
 
 #include "ReducerWorkItem.h"
 #include "TestRunner.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Analysis/ModuleSummaryAnalysis.h"
 #include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/Bitcode/BitcodeReader.h"
@@ -31,11 +32,13 @@
 #include "llvm/IRReader/IRReader.h"
 #include "llvm/MC/TargetRegistry.h"
 #include "llvm/Passes/PassBuilder.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/MemoryBufferRef.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/WithColor.h"
+#include "llvm/Support/xxhash.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/TargetParser/Host.h"
 #include "llvm/Transforms/IPO/ThinLTOBitcodeWriter.h"
@@ -62,6 +65,12 @@ static cl::opt<bool> TmpFilesAsBitcode(
     cl::desc("Always write temporary files as bitcode instead of textual IR"),
     cl::init(false), cl::cat(LLVMReduceOptions));
 
+static cl::opt<bool> CacheTestResults(
+    "cache-test-results",
+    cl::desc("Do not rerun the interestingness test on a candidate identical "
+             "to one that was already tested (requires a deterministic test)"),
+    cl::init(true), cl::cat(LLVMReduceOptions));
+
 static void cloneFrameInfo(
     MachineFrameInfo &DstMFI, const MachineFrameInfo &SrcMFI,
     const DenseMap<MachineBasicBlock *, MachineBasicBlock *> &Src2DstMBB) {
@@ -502,8 +511,26 @@ bool ReducerWorkItem::isReduced(const TestRunner &Test) const {
     exit(1);
   }
 
+  // Different chunk selections can produce identical candidates, for example
+  // when a delta pass finds nothing to remove. Reuse the result of the earlier
+  // test for those instead of running the test again.
+  std::optional<XXH128_hash_t> Hash;
+  if (CacheTestResults) {
+    ErrorOr<std::unique_ptr<MemoryBuffer>> Buffer =
+        MemoryBuffer::getFile(CurrentFilepath, /*IsText=*/false,
+                              /*RequiresNullTerminator=*/false);
+    if (Buffer) {
+      Hash = xxh3_128bits(arrayRefFromStringRef((*Buffer)->getBuffer()));
+      if (std::optional<bool> Cached = Test.getCachedResult(*Hash))
+        return *Cached;
+    }
+  }
+
   // Current Chunks aren't interesting
-  return Test.run(CurrentFilepath);
+  bool Interesting = Test.run(CurrentFilepath);
+  if (Hash)
+    Test.cacheResult(*Hash, Interesting);
+  return Interesting;
 }
 
 std::unique_ptr<ReducerWorkItem>
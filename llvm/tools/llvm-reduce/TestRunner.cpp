@@ -54,6 +54,19 @@ int TestRunner::run(StringRef Filename) const {
   return !Result;
 }
 
+std::optional<bool> TestRunner::getCachedResult(XXH128_hash_t Hash) const {
+  std::lock_guard<std::mutex> Lock(ResultCacheMutex);
+  auto It = ResultCache.find({Hash.low64, Hash.high64});
+  if (It == ResultCache.end())
+    return std::nullopt;
+  return It->second;
+}
+
+void TestRunner::cacheResult(XXH128_hash_t Hash, bool Interesting) const {
+  std::lock_guard<std::mutex> Lock(ResultCacheMutex);
+  ResultCache.try_emplace({Hash.low64, Hash.high64}, Interesting);
+}
+
 void TestRunner::writeOutput(StringRef Message) {
   std::error_code EC;
   raw_fd_ostream Out(OutputFilename, EC,
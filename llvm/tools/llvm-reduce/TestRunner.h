@@ -10,12 +10,16 @@
 #define LLVM_TOOLS_LLVM_REDUCE_TESTRUNNER_H
 
 #include "ReducerWorkItem.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/IR/Module.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Program.h"
+#include "llvm/Support/xxhash.h"
 #include "llvm/Target/TargetMachine.h"
+#include <mutex>
+#include <optional>
 #include <vector>
 
 namespace llvm {
@@ -34,6 +38,14 @@ public:
   /// @returns 0 if test was successful, 1 if otherwise
   int run(StringRef Filename) const;
 
+  /// Returns the result of an earlier run of the interesting-ness test on a
+  /// file whose contents hash to \p Hash, if there was one.
+  std::optional<bool> getCachedResult(XXH128_hash_t Hash) const;
+
+  /// Remembers the result of running the interesting-ness test on a file whose
+  /// contents hash to \p Hash.
+  void cacheResult(XXH128_hash_t Hash, bool Interesting) const;
+
   /// Returns the most reduced version of the original testcase
   ReducerWorkItem &getProgram() const { return *Program; }
 
@@ -61,6 +73,10 @@ private:
   StringRef OutputFilename;
   const bool InputIsBitcode;
   bool EmitBitcode;
+
+  // Candidates are tested from several threads with -j.
+  mutable std::mutex ResultCacheMutex;
+  mutable DenseMap<std::pair<uint64_t, uint64_t>, bool> ResultCache;
 };
 
 } // namespace llvm
@@ -0,0 +1,72 @@
+//===- unittest/DebugInfo/Symbolizer/SymbolizeTest.cpp --------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/DebugInfo/Symbolize/Symbolize.h"
+#include "llvm/Object/ObjectFile.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Testing/Support/Error.h"
+
+#include "gtest/gtest.h"
+
+extern const char *TestMainArgv0;
+
+namespace {
+
+using namespace llvm;
+using namespace llvm::object;
+using namespace llvm::symbolize;
+
+// Symbolize a few function symbols of the test binary itself, plus an address
+// that is not covered by anything, both one at a time and as a batch.
+TEST(SymbolizeTest, CodeBatchMatchesPerAddress) {
+  std::string Path = sys::fs::getMainExecutable(TestMainArgv0, &TestMainArgv0);
+  auto BinOrErr = createBinary(Path);
+  if (!BinOrErr) {
+    consumeError(BinOrErr.takeError());
+    GTEST_SKIP();
+  }
+  auto *Obj = dyn_cast<ObjectFile>(BinOrErr->getBinary());
+  if (!Obj)
+    GTEST_SKIP();
+
+  std::vector<SectionedAddress> Offsets;
+  for (const SymbolRef &Sym : Obj->symbols()) {
+    Expected<SymbolRef::Type> Type = Sym.getType();
+    Expected<uint64_t> Addr = Sym.getAddress();
+    if (!Type || !Addr) {
+      consumeError(Type.takeError());
+      consumeError(Addr.takeError());
+      continue;
+    }
+    if (*Type != SymbolRef::ST_Function || *Addr == 0)
+      continue;
+    Offsets.push_back({*Addr, SectionedAddress::UndefSection});
+    if (Offsets.size() == 8)
+      break;
+  }
+  if (Offsets.empty())
+    GTEST_SKIP();
+  Offsets.push_back({UINT64_MAX - 1, SectionedAddress::UndefSection});
+
+  LLVMSymbolizer Symbolizer;
+  Expected<std::vector<DILineInfo>> Batch =
+      Symbolizer.symbolizeCodeBatch(Path, Offsets);
+  ASSERT_THAT_EXPECTED(Batch, Succeeded());
+  ASSERT_EQ(Batch->size(), Offsets.size());
+
+  for (size_t I = 0; I != Offsets.size(); ++I) {
+    Expected<DILineInfo> Single = Symbolizer.symbolizeCode(Path, Offsets[I]);
+    ASSERT_THAT_EXPECTED(Single, Succeeded());
+    EXPECT_TRUE((*Batch)[I] == *Single) << "offset " << I;
+  }
+
+  // No line table covers the invalid address.
+  EXPECT_EQ(Batch->back().Line, 0u);
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+//===------- OnDiskObjectCacheTest.cpp - Unit tests for OnDiskObjectCache -===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/Orc/OnDiskObjectCache.h"
+#include "OrcTestCommon.h"
+#include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Testing/Support/Error.h"
+#include "llvm/Testing/Support/SupportHelpers.h"
+
+using namespace llvm;
+using namespace llvm::orc;
+
+namespace {
+
+static std::unique_ptr<Module> createModule(LLVMContext &Ctx, int RetVal) {
+  auto M = std::make_unique<Module>("<main>", Ctx);
+  IRBuilder<> Builder(Ctx);
+  Function *F = Function::Create(
+      FunctionType::get(Builder.getInt32Ty(), {}, false),
+      GlobalValue::ExternalLinkage, "main", M.get());
+  Builder.SetInsertPoint(BasicBlock::Create(Ctx, "entry", F));
+  Builder.CreateRet(Builder.getInt32(RetVal));
+  return M;
+}
+
+TEST(OnDiskObjectCacheTest, HitAfterMissAcrossInstances) {
+  OrcNativeTarget::initialize();
+
+  auto JTMB = JITTargetMachineBuilder::detectHost();
+  if (!JTMB) {
+    consumeError(JTMB.takeError());
+    GTEST_SKIP();
+  }
+  auto TM = JTMB->createTargetMachine();
+  if (!TM) {
+    consumeError(TM.takeError());
+    GTEST_SKIP();
+  }
+
+  unittest::TempDir CacheDir("orc-object-cache", /*Unique=*/true);
+  LLVMContext Ctx;
+  auto M42 = createModule(Ctx, 42);
+  auto M53 = createModule(Ctx, 53);
+
+  {
+    auto Cache = OnDiskObjectCache::Create(CacheDir.path(), **TM);
+    ASSERT_THAT_EXPECTED(Cache, Succeeded());
+    EXPECT_EQ((*Cache)->getObject(M42.get()), nullptr);
+    auto Obj = MemoryBuffer::getMemBuffer("object-42", "", false);
+    (*Cache)->notifyObjectCompiled(M42.get(), Obj->getMemBufferRef());
+  }
+
+  // A fresh cache over the same directory finds the object for the same
+  // module, but not for a different one.
+  auto Cache = OnDiskObjectCache::Create(CacheDir.path(), **TM);
+  ASSERT_THAT_EXPECTED(Cache, Succeeded());
+  auto Cached = (*Cache)->getObject(M42.get());
+  ASSERT_NE(Cached, nullptr);
+  EXPECT_EQ(Cached->getBuffer(), "object-42");
+  EXPECT_EQ((*Cache)->getObject(M53.get()), nullptr);
+}
+
+TEST(OnDiskObjectCacheTest, DifferentRelocModelMisses) {
+  OrcNativeTarget::initialize();
+
+  auto PICJTMB = JITTargetMachineBuilder::detectHost();
+  auto StaticJTMB = JITTargetMachineBuilder::detectHost();
+  if (!PICJTMB || !StaticJTMB) {
+    consumeError(PICJTMB.takeError());
+    consumeError(StaticJTMB.takeError());
+    GTEST_SKIP();
+  }
+  PICJTMB->setRelocationModel(Reloc::PIC_);
+  StaticJTMB->setRelocationModel(Reloc::Static);
+  auto PICTM = PICJTMB->createTargetMachine();
+  auto StaticTM = StaticJTMB->createTargetMachine();
+  if (!PICTM || !StaticTM) {
+    consumeError(PICTM.takeError());
+    consumeError(StaticTM.takeError());
+    GTEST_SKIP();
+  }
+
+  unittest::TempDir CacheDir("orc-object-cache", /*Unique=*/true);
+  LLVMContext Ctx;
+  auto M = createModule(Ctx, 42);
+
+  auto PICCache = OnDiskObjectCache::Create(CacheDir.path(), **PICTM);
+  ASSERT_THAT_EXPECTED(PICCache, Succeeded());
+  auto Obj = MemoryBuffer::getMemBuffer("object-pic", "", false);
+  (*PICCache)->notifyObjectCompiled(M.get(), Obj->getMemBufferRef());
+
+  // The same module compiled with a different relocation model must not pick
+  // up the PIC object.
+  auto StaticCache = OnDiskObjectCache::Create(CacheDir.path(), **StaticTM);
+  ASSERT_THAT_EXPECTED(StaticCache, Succeeded());
+  EXPECT_EQ((*StaticCache)->getObject(M.get()), nullptr);
+
+  auto Cached = (*PICCache)->getObject(M.get());
+  ASSERT_NE(Cached, nullptr);
+  EXPECT_EQ(Cached->getBuffer(), "object-pic");
+}
+
+} // end anonymous namespace
@@ -17,11 +17,27 @@
 #include "llvm/TargetParser/Host.h"
 #include "llvm/Testing/Support/Error.h"
 #include "gtest/gtest.h"
+#include <optional>
 
 using namespace llvm;
 using namespace llvm::orc;
 using namespace llvm::jitlink;
 
+static Function *createRetFunction(Module *M, StringRef Name,
+                                   uint32_t ReturnCode) {
+  Function *Result = Function::Create(
+      FunctionType::get(Type::getInt32Ty(M->getContext()), {}, false),
+      GlobalValue::ExternalLinkage, Name, M);
+
+  BasicBlock *BB = BasicBlock::Create(M->getContext(), Name, Result);
+  IRBuilder<> Builder(M->getContext());
+  Builder.SetInsertPoint(BB);
+
+  Value *RetValue = ConstantInt::get(M->getContext(), APInt(32, ReturnCode));
+  Builder.CreateRet(RetValue);
+  return Result;
+}
+
 class ReOptimizeLayerTest : public testing::Test {
 public:
   ~ReOptimizeLayerTest() {
@@ -106,6 +122,73 @@ protected:
     return ROLayer->add(std::move(RT), std::move(TSM));
   }
 
+  // Set up ROLayer, optionally with a custom call-count Threshold, so that
+  // reoptimizing a module makes all its functions return 53, then add a
+  // "main" that returns 42 and look it up.
+  using MainFn = int (*)();
+  MainFn addReoptimizableMain(std::optional<uint64_t> Threshold) {
+    MangleAndInterner Mangle(*ES, *DL);
+
+    auto &EPC = ES->getExecutorProcessControl();
+    EXPECT_THAT_ERROR(JD->define(absoluteSymbols(
+                          {{Mangle("__orc_rt_jit_dispatch"),
+                            {EPC.getJITDispatchInfo().JITDispatchFunction,
+                             JITSymbolFlags::Exported}},
+                           {Mangle("__orc_rt_jit_dispatch_ctx"),
+                            {EPC.getJITDispatchInfo().JITDispatchContext,
+                             JITSymbolFlags::Exported}},
+                           {Mangle("__orc_rt_reoptimize_tag"),
+                            {ExecutorAddr(), JITSymbolFlags::Exported}}})),
+                      Succeeded());
+
+    auto RM = JITLinkRedirectableSymbolManager::Create(*ObjLinkingLayer);
+    EXPECT_THAT_ERROR(RM.takeError(), Succeeded());
+
+    ROLayer = std::make_unique<ReOptimizeLayer>(*ES, *DL, *CompileLayer, **RM);
+    if (Threshold)
+      ROLayer->setAddProfilerFunc(
+          ReOptimizeLayer::reoptimizeIfCallCountExceeds(*Threshold));
+    ROLayer->setReoptimizeFunc(
+        [&](ReOptimizeLayer &Parent,
+            ReOptimizeLayer::ReOptMaterializationUnitID MUID,
+            unsigned CurVersion, ResourceTrackerSP OldRT,
+            ThreadSafeModule &TSM) {
+          ++ReoptimizeCount;
+          TSM.withModuleDo([&](Module &M) {
+            for (auto &F : M) {
+              if (F.isDeclaration())
+                continue;
+              for (auto &B : F) {
+                for (auto &I : B) {
+                  if (ReturnInst *Ret = dyn_cast<ReturnInst>(&I)) {
+                    Value *RetValue =
+                        ConstantInt::get(M.getContext(), APInt(32, 53));
+                    Ret->setOperand(0, RetValue);
+                  }
+                }
+              }
+            }
+          });
+          return Error::success();
+        });
+    EXPECT_THAT_ERROR(ROLayer->reigsterRuntimeFunctions(*JD), Succeeded());
+
+    ThreadSafeContext Ctx(std::make_unique<LLVMContext>());
+    auto M = std::make_unique<Module>("<main>", *Ctx.getContext());
+    M->setTargetTriple(Triple(sys::getProcessTriple()));
+
+    (void)createRetFunction(M.get(), "main", 42);
+
+    EXPECT_THAT_ERROR(
+        addIRModule(JD->getDefaultResourceTracker(),
+                    ThreadSafeModule(std::move(M), std::move(Ctx))),
+        Succeeded());
+
+    auto Result = cantFail(ES->lookup({JD}, Mangle("main")));
+    return Result.getAddress().toPtr<MainFn>();
+  }
+
+  unsigned ReoptimizeCount = 0;
   JITDylib *JD{nullptr};
   std::unique_ptr<ExecutionSession> ES;
   std::unique_ptr<ObjectLinkingLayer> ObjLinkingLayer;
@@ -114,76 +197,27 @@ protected:
   std::unique_ptr<DataLayout> DL;
 };
 
-static Function *createRetFunction(Module *M, StringRef Name,
-                                   uint32_t ReturnCode) {
-  Function *Result = Function::Create(
-      FunctionType::get(Type::getInt32Ty(M->getContext()), {}, false),
-      GlobalValue::ExternalLinkage, Name, M);
-
-  BasicBlock *BB = BasicBlock::Create(M->getContext(), Name, Result);
-  IRBuilder<> Builder(M->getContext());
-  Builder.SetInsertPoint(BB);
-
-  Value *RetValue = ConstantInt::get(M->getContext(), APInt(32, ReturnCode));
-  Builder.CreateRet(RetValue);
-  return Result;
-}
-
 TEST_F(ReOptimizeLayerTest, BasicReOptimization) {
-  MangleAndInterner Mangle(*ES, *DL);
-
-  auto &EPC = ES->getExecutorProcessControl();
-  EXPECT_THAT_ERROR(JD->define(absoluteSymbols(
-                        {{Mangle("__orc_rt_jit_dispatch"),
-                          {EPC.getJITDispatchInfo().JITDispatchFunction,
-                           JITSymbolFlags::Exported}},
-                         {Mangle("__orc_rt_jit_dispatch_ctx"),
-                          {EPC.getJITDispatchInfo().JITDispatchContext,
-                           JITSymbolFlags::Exported}},
-                         {Mangle("__orc_rt_reoptimize_tag"),
-                          {ExecutorAddr(), JITSymbolFlags::Exported}}})),
-                    Succeeded());
-
-  auto RM = JITLinkRedirectableSymbolManager::Create(*ObjLinkingLayer);
-  EXPECT_THAT_ERROR(RM.takeError(), Succeeded());
-
-  ROLayer = std::make_unique<ReOptimizeLayer>(*ES, *DL, *CompileLayer, **RM);
-  ROLayer->setReoptimizeFunc(
-      [&](ReOptimizeLayer &Parent,
-          ReOptimizeLayer::ReOptMaterializationUnitID MUID, unsigned CurVerison,
-          ResourceTrackerSP OldRT, ThreadSafeModule &TSM) {
-        TSM.withModuleDo([&](Module &M) {
-          for (auto &F : M) {
-            if (F.isDeclaration())
-              continue;
-            for (auto &B : F) {
-              for (auto &I : B) {
-                if (ReturnInst *Ret = dyn_cast<ReturnInst>(&I)) {
-                  Value *RetValue =
-                      ConstantInt::get(M.getContext(), APInt(32, 53));
-                  Ret->setOperand(0, RetValue);
-                }
-              }
-            }
-          }
-        });
-        return Error::success();
-      });
-  EXPECT_THAT_ERROR(ROLayer->reigsterRuntimeFunctions(*JD), Succeeded());
-
-  ThreadSafeContext Ctx(std::make_unique<LLVMContext>());
-  auto M = std::make_unique<Module>("<main>", *Ctx.getContext());
-  M->setTargetTriple(Triple(sys::getProcessTriple()));
-
-  (void)createRetFunction(M.get(), "main", 42);
+  auto FuncPtr = addReoptimizableMain(std::nullopt);
+  for (size_t I = 0; I <= ReOptimizeLayer::CallCountThreshold; I++)
+    EXPECT_EQ(FuncPtr(), 42);
+  EXPECT_EQ(FuncPtr(), 53);
+}
 
-  EXPECT_THAT_ERROR(addIRModule(JD->getDefaultResourceTracker(),
-                                ThreadSafeModule(std::move(M), std::move(Ctx))),
-                    Succeeded());
+TEST_F(ReOptimizeLayerTest, CustomCallCountThreshold) {
+  constexpr uint64_t Threshold = 2;
+  auto FuncPtr = addReoptimizableMain(Threshold);
 
-  auto Result = cantFail(ES->lookup({JD}, Mangle("main")));
-  auto FuncPtr = Result.getAddress().toPtr<int (*)()>();
-  for (size_t I = 0; I <= ReOptimizeLayer::CallCountThreshold; I++)
+  // The first Threshold calls only bump the counter.
+  for (size_t I = 0; I < Threshold; I++)
     EXPECT_EQ(FuncPtr(), 42);
+  EXPECT_EQ(ReoptimizeCount, 0u);
+
+  // The next call finds the counter at Threshold and requests
+  // reoptimization, which takes effect from the following call on.
+  EXPECT_EQ(FuncPtr(), 42);
+  EXPECT_EQ(ReoptimizeCount, 1u);
+  EXPECT_EQ(FuncPtr(), 53);
   EXPECT_EQ(FuncPtr(), 53);
+  EXPECT_EQ(ReoptimizeCount, 1u);
 }
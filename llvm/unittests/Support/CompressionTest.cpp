@@ -110,5 +110,22 @@ TEST(CompressionTest, Zstd) {
   testZstdCompression(BinaryDataStr, zstd::BestSpeedCompression);
   testZstdCompression(BinaryDataStr, zstd::DefaultCompression);
 }
+
+TEST(CompressionTest, ZstdWorkers) {
+  // Several zstd jobs' worth of input, so that workers actually get used when
+  // libzstd supports them.
+  std::string Input;
+  for (unsigned I = 0; Input.size() < (4u << 20); ++I)
+    Input += "entry " + std::to_string(I * 2654435761u) + "\n";
+
+  SmallVector<uint8_t, 0> Compressed;
+  SmallVector<uint8_t, 0> Uncompressed;
+  zstd::compress(arrayRefFromStringRef(Input), Compressed,
+                 zstd::DefaultCompression, /*EnableLdm=*/false,
+                 /*NumWorkers=*/4);
+  Error E = zstd::decompress(Compressed, Uncompressed, Input.size());
+  EXPECT_FALSE(std::move(E));
+  EXPECT_EQ(Input, toStringRef(Uncompressed));
+}
 #endif
 }
@@ -47,6 +47,7 @@
 #include "llvm/Support/ScopedPrinter.h"
 #include "llvm/TableGen/Error.h"
 #include "llvm/TableGen/Record.h"
+#include "llvm/TableGen/TGTimer.h"
 #include "llvm/TableGen/TableGenBackend.h"
 #include <string>
 
@@ -2400,6 +2401,8 @@ bool hasBFloatType(const TreePatternNode &Node) {
 }
 
 void GlobalISelEmitter::run(raw_ostream &OS) {
+  TGTimer &Timer = RK.getTimer();
+  Timer.startTimer("Gather records");
   if (!UseCoverageFile.empty()) {
     RuleCoverage = CodeGenCoverage();
     auto RuleCoverageBufOrErr = MemoryBuffer::getFile(UseCoverageFile);
@@ -2428,8 +2431,13 @@ void GlobalISelEmitter::run(raw_ostream &OS) {
       ("Global Instruction Selector for the " + Target.getName() + " target")
           .str(),
       OS);
+  Timer.startTimer("Import patterns");
   std::vector<RuleMatcher> Rules;
   // Look through the SelectionDAG patterns we found, possibly emitting some.
+  // FIXME: Patterns are imported one at a time. Most of runOnPattern is
+  // independent per pattern, but it also assigns rule IDs and records
+  // subtarget features, HW modes and types in emitter-wide state, which
+  // would need to be made deterministic before importing in parallel.
   for (const PatternToMatch &Pat : CGP.ptms()) {
     ++NumPatternTotal;
 
@@ -2494,6 +2502,7 @@ void GlobalISelEmitter::run(raw_ostream &OS) {
   llvm::sort(TypeObjects);
 
   // Sort rules.
+  Timer.startTimer("Sort rules");
   llvm::stable_sort(Rules, [&](const RuleMatcher &A, const RuleMatcher &B) {
     int ScoreA = RuleMatcherScores[A.getRuleID()];
     int ScoreB = RuleMatcherScores[B.getRuleID()];
@@ -2515,9 +2524,11 @@ void GlobalISelEmitter::run(raw_ostream &OS) {
     MaxTemporaries = std::max(MaxTemporaries, Rule.countRendererFns());
 
   // Build match table
+  Timer.startTimer("Build match table");
   const MatchTable Table =
       buildMatchTable(Rules, OptimizeMatchTable, GenerateCoverage);
 
+  Timer.startTimer("Emit match table");
   emitPredicateBitset(OS, "GET_GLOBALISEL_PREDICATE_BITSET");
   emitTemporariesDecl(OS, "GET_GLOBALISEL_TEMPORARIES_DECL");
   emitTemporariesInit(OS, MaxTemporaries, "GET_GLOBALISEL_TEMPORARIES_INIT");
@@ -81,12 +81,16 @@ private:
 bool isBytecode(llvm::MemoryBufferRef buffer);
 
 /// Read the operations defined within the given memory buffer, containing MLIR
-/// bytecode, into the provided block.
+/// bytecode, into the provided block. Since the buffer may not outlive the
+/// parsed IR, the contents of blob resources are copied out of it.
 LogicalResult readBytecodeFile(llvm::MemoryBufferRef buffer, Block *block,
                                const ParserConfig &config);
 /// An overload with a source manager whose main file buffer is used for
 /// parsing. The lifetime of the source manager may be freely extended during
 /// parsing such that the source manager is not destroyed before the parsed IR.
+/// Blob resources then reference the buffer directly instead of being copied,
+/// which avoids duplicating large embedded data such as weights when the
+/// buffer is memory mapped.
 LogicalResult
 readBytecodeFile(const std::shared_ptr<llvm::SourceMgr> &sourceMgr,
                  Block *block, const ParserConfig &config);
@@ -104,6 +104,12 @@ Location LatticeAnchor::getLoc() const {
 // DataFlowSolver
 //===----------------------------------------------------------------------===//
 
+// FIXME: every call re-primes the analyses over all of `top` and iterates to a
+// fixpoint from scratch. Clients that rewrite IR can drop stale states with
+// eraseState(), but there is no way to re-run only from the changed anchors:
+// that would need an entry point that resets the dependents of those anchors
+// to their initial state (lattices only move up during a run) and seeds the
+// worklist with them instead of calling initialize() on the whole operation.
 LogicalResult DataFlowSolver::initializeAndRun(Operation *top) {
   // Enable enqueue to the worklist.
   isRunning = true;
@@ -1430,6 +1430,12 @@ private:
 };
 } // namespace
 
+// FIXME: values are numbered on a single thread in one walk over `op`, and
+// printing then streams sequentially. Since each region restarts from the
+// naming context of its parent, the bodies of sibling IsolatedFromAbove ops
+// could be numbered and printed into separate buffers concurrently. That would
+// need the shared usedNames table and opResultGroups/blockNames maps to become
+// per-subtree, and the dialect resource bookkeeping to be safe to share.
 SSANameState::SSANameState(Operation *op, const OpPrintingFlags &printerFlags)
     : printerFlags(printerFlags) {
   llvm::SaveAndRestore valueIDSaver(nextValueID);
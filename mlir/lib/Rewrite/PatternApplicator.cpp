@@ -141,6 +141,10 @@ LogicalResult PatternApplicator::matchAndRewrite(
     bytecode->match(op, rewriter, pdlMatches, *mutableByteCodeState);
 
   // Check to see if there are patterns matching this specific operation type.
+  // FIXME: beyond the root operation name, native patterns are opaque, so each
+  // candidate is tried in benefit order. Sharing predicate checks across them
+  // the way the PDL bytecode does would require patterns to expose their
+  // operand and attribute constraints declaratively.
   MutableArrayRef<const RewritePattern *> opPatterns;
   auto patternIt = patterns.find(op->getName());
   if (patternIt != patterns.end())
@@ -177,8 +177,11 @@ public:
 private:
   /// Return the shard used for the given hash value.
   Shard &getShard(unsigned hashValue) {
-    // Get a shard number from the provided hashvalue.
-    unsigned shardNum = hashValue & (numShards - 1);
+    // Get a shard number from the provided hashvalue. The shard's instance
+    // set buckets entries by the low bits of the same hash, so pick the shard
+    // from a remixed hash: otherwise every instance in a shard would share its
+    // low bits and initial probes would only land in 1/numShards of the set.
+    unsigned shardNum = llvm::hash_value(hashValue) & (numShards - 1);
 
     // Try to acquire an already initialized shard.
     Shard *shard = shards[shardNum].load(std::memory_order_acquire);
@@ -1860,6 +1860,10 @@ LogicalResult ModuleTranslation::convertFunctionSignatures() {
 
 LogicalResult ModuleTranslation::convertFunctions() {
   // Convert functions.
+  // FIXME: bodies are translated one after the other. They only depend on the
+  // declarations created earlier, but they all build instructions, constants
+  // and metadata in the one llvm::LLVMContext, which is not thread-safe, and
+  // share the value/block mappings and debug translation state of this object.
   for (auto function : getModuleBody(mlirModule).getOps<LLVMFuncOp>()) {
     // Do not convert external functions, but do process dialect attributes
     // attached to them.
@@ -868,6 +868,11 @@ struct ConversionPatternRewriterImpl : public RewriterBase::Listener {
 
   /// Append a rewrite. Rewrites are committed upon success and rolled back upon
   /// failure.
+  ///
+  /// FIXME: rewrites are recorded even when `config.allowPatternRollback` is
+  /// unset. Replacements and erasures are only materialized in applyRewrites()
+  /// and value remapping goes through the log, so committing them in place has
+  /// to wait for the One-Shot Dialect Conversion driver.
   template <typename RewriteTy, typename... Args>
   void appendRewrite(Args &&...args) {
     rewrites.push_back(
@@ -824,6 +824,13 @@ private:
 };
 } // namespace
 
+// FIXME: the worklist is processed on a single thread even when the region
+// holds many independent blocks or use-def subgraphs. Parallelism is only
+// available across IsolatedFromAbove ops through the pass manager. Rewriting
+// within a region concurrently would need patterns to declare which IR they
+// may touch, since any pattern can currently erase users or producers of its
+// root, fold into shared constants via OperationFolder, and notify the shared
+// listener and worklist.
 LogicalResult RegionPatternRewriteDriver::simplify(bool *changed) && {
   bool continueRewrites = false;
   int64_t iteration = 0;
@@ -128,6 +128,11 @@ int MappingInfoTy::disassociatePtr(void *HstPtrBegin) {
   return OFFLOAD_FAIL;
 }
 
+// FIXME: Every mapped argument of every target region takes the mapping table
+// lock (held by the HDTTMap accessor) for this lookup. For kernels launched at
+// a high rate with the same arguments, a per-thread cache of recently found
+// entries, validated against a table generation counter bumped on insertion
+// and removal, would let most lookups skip the lock and the tree walk.
 LookupResult MappingInfoTy::lookupMapping(HDTTMapAccessorTy &HDTTMap,
                                           void *HstPtrBegin, int64_t Size,
                                           HostDataToTargetTy *OwnedTPR) {